@@ -0,0 +1,168 @@
+// arithmetics.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file arithmetics.cpp
+
+ Measures the per-element cost of the fixed-point addition and multiplication
+ against the plain integer code doing the same. The range checks must vanish
+ if both policies are libq::ignorance_policy.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o arithmetics ./arithmetics.cpp
+./arithmetics
+\endverbatim
+ To compare the instructions, see the kernels plus<T> and multiplies<T> in the
+ output of
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -S -o - ./arithmetics.cpp | c++filt
+\endverbatim
+ \note The checked kernels are not vectorized since every element may throw.
+ The saturated ones are scalar too: the clamps are mostly conditional moves.
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0:
+ \verbatim
+|            format            | add (ns) | mul (ns) |
+-----------------------------------------------------
+|       std::int32_t           |   0.28   |   0.70   |
+|   Q30.20 (ignorance_policy)  |   0.34   |   0.65   |
+| Q30.20 (overflow exceptions) |   1.13   |   1.13   |
+|  Q30.20 (saturation_policy)  |   0.96   |   1.13   |
+|   Q24.23 (ignorance_policy)  |   0.15   |   0.58   |
+| Q24.23 (overflow exceptions) |   1.10   |   1.27   |
+|  Q24.23 (saturation_policy)  |   0.90   |   1.07   |
+|   Q61.52 (ignorance_policy)  |   0.30   |   0.66   |
+| Q61.52 (overflow exceptions) |   0.55   |   1.07   |
+-----------------------------------------------------
+\endverbatim
+ \note The 64-bit stored integers of Q61.52 are multiplied by one widening
+ multiplication into __int128, so the products are exact.
+*/
+
+#include <cstdlib>
+#include <cstdint>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 4096u
+#define REPEATS 20000u
+
+
+std::intmax_t volatile sink;
+
+std::intmax_t stored_integer(std::intmax_t const _x) {
+    return _x;
+}
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+std::intmax_t stored_integer(libq::fixed_point<T, n, f, e, op, up> const& _x) {
+    return static_cast<std::intmax_t>(_x.value());
+}
+
+
+template<typename T>
+void plus(std::vector<T> const& _x,
+          std::vector<T> const& _y,
+          std::vector<decltype(T() + T())>& _result) {
+    for (std::size_t i = 0; i != N; ++i) {
+        _result[i] = _x[i] + _y[i];
+    }
+}
+
+std::int64_t product(std::int32_t const _x, std::int32_t const _y) {
+    return static_cast<std::int64_t>(_x) * _y;
+}
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+auto product(libq::fixed_point<T, n, f, e, op, up> const& _x,
+             libq::fixed_point<T, n, f, e, op, up> const& _y)
+    -> decltype(_x * _y) {
+    return _x * _y;
+}
+
+template<typename T>
+void multiplies(std::vector<T> const& _x,
+                std::vector<T> const& _y,
+                std::vector<decltype(product(T(), T()))>& _result) {
+    for (std::size_t i = 0; i != N; ++i) {
+        _result[i] = product(_x[i], _y[i]);
+    }
+}
+
+
+template<typename T, typename R, typename Kernel>
+double elapsed_per_element(std::vector<T> const& _x,
+                           std::vector<T> const& _y,
+                           std::vector<R>& _result,
+                           Kernel _kernel) {
+    using namespace std::chrono;  // NOLINT
+
+    auto const start = steady_clock::now();
+    for (std::size_t k = 0; k != REPEATS; ++k) {
+        _kernel(_x, _y, _result);
+        sink = stored_integer(_result[k % N]);
+    }
+    auto const end = steady_clock::now();
+    duration<double, std::nano> const elapsed = end - start;
+
+    return elapsed.count() / (N * REPEATS);
+}
+
+
+template<typename T>
+void measure(char const* _name, std::vector<double> const& _samples) {
+    std::vector<T> x, y;
+    for (std::size_t i = 0; i != N; ++i) {
+        x.push_back(T(_samples[i]));
+        y.push_back(T(_samples[N - 1u - i]));
+    }
+
+    std::vector<decltype(T() + T())> sum(N);
+    std::vector<decltype(product(T(), T()))> product(N);
+
+    double const add = elapsed_per_element(x, y, sum, plus<T>);
+    double const mul = elapsed_per_element(x, y, product, multiplies<T>);
+    std::cout
+        << _name << ": add " << add << " ns, mul " << mul << " ns"
+        << std::endl;
+}
+
+
+int main(int, char**) {
+    using Q = libq::Q<30, 20>;
+    using checked_Q = libq::Q<30, 20, 0, libq::overflow_exception_policy>;
+    using Q1 = libq::Q<24, 23>;
+    using checked_Q1 = libq::Q<24, 23, 0, libq::overflow_exception_policy>;
+    using saturated_Q = libq::Q<30, 20, 0, libq::saturation_policy>;
+    using saturated_Q1 = libq::Q<24, 23, 0, libq::saturation_policy>;
+    using Q2 = libq::Q<61, 52>;
+    using checked_Q2 = libq::Q<61, 52, 0, libq::overflow_exception_policy>;
+
+    std::vector<double> samples(N), samples1(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        samples[i] = -100.0 + 200.0 * i / N;
+        samples1[i] = -1.0 + 2.0 * i / N;
+    }
+
+    std::vector<double> integers(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        integers[i] = static_cast<double>(Q(samples[i]).value());
+    }
+
+    measure<std::int32_t>("std::int32_t", integers);
+    measure<Q>("Q30.20 (ignorance_policy)", samples);
+    measure<checked_Q>("Q30.20 (overflow exceptions)", samples);
+    measure<saturated_Q>("Q30.20 (saturation_policy)", samples);
+    measure<Q1>("Q24.23 (ignorance_policy)", samples1);
+    measure<checked_Q1>("Q24.23 (overflow exceptions)", samples1);
+    measure<saturated_Q1>("Q24.23 (saturation_policy)", samples1);
+    measure<Q2>("Q61.52 (ignorance_policy)", samples1);
+    measure<checked_Q2>("Q61.52 (overflow exceptions)", samples1);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,289 @@
+// batch.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file batch.cpp
+
+ Compares the per-element cost of the batch operations and the reductions with
+ one of the scalar loops doing the same.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o batch ./batch.cpp
+./batch
+\endverbatim
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0, the
+ batch operations use AVX-512 (scalar/batch, ns):
+ \verbatim
+|   format (policy)   |     add     |     mul     |     div     |     neg     |
+------------------------------------------------------------------------------
+|        Q15.8        | 1.01 / 0.03 | 1.03 / 0.11 | 2.15 / 0.72 | 0.42 / 0.04 |
+|  Q15.8 (saturation) | 1.08 / 0.24 | 1.35 / 0.40 | 2.20 / 0.87 | 0.72 / 0.04 |
+|  Q15.8 (exception)  | 1.04 / 0.16 | 1.09 / 0.40 | 2.15 / 0.75 | 0.72 / 0.11 |
+|       Q30.20        | 1.02 / 0.07 | 1.03 / 0.25 | 3.58 / 3.58 | 0.42 / 0.04 |
+| Q30.20 (saturation) | 1.44 / 0.38 | 1.48 / 0.39 | 3.59 / 3.59 | 0.72 / 0.05 |
+|    Q30.20 (flag)    | 1.26 / 0.35 | 1.26 / 0.46 | 3.58 / 3.58 | 0.72 / 0.13 |
+|      UQ23.13.3      | 1.02 / 0.07 | 1.03 / 0.25 | 3.58 / 0.76 | 0.42 / 0.04 |
+|       Q62.30        | 1.19 / 0.30 | 1.24 / 0.91 | 3.60 / 3.61 | 0.60 / 0.25 |
+------------------------------------------------------------------------------
+\endverbatim
+ \note The division is vectorized if the double holds the scaled dividend,
+ i.e. for the formats of up to 26 significant bits. Otherwise, it runs the
+ scalar loop.
+ \note The reductions vs. the scalar loops summing within format Q (scalar/batch,
+ ns):
+ \verbatim
+|   format (policy)   |     sum     |     dot     |
+-------------------------------------------------
+|        Q7.5         | 0.36 / 0.05 | 0.78 / 0.07 |
+|        Q15.8        | 0.38 / 0.04 | 0.81 / 0.07 |
+|  Q15.8 (saturation) | 1.79 / 0.04 | 1.63 / 0.07 |
+|       Q30.20        | 0.38 / 0.08 | 0.81 / 0.60 |
+|       Q31.29        | 0.37 / 0.08 | 0.81 / 0.60 |
+-------------------------------------------------
+\endverbatim
+ \note The products of 32-bit stored integers are summed within 128-bit
+ integers, so the dot products of such formats are not vectorized.
+ \note The conversions of the floats of alternating signs and back
+ (scalar/batch, ns):
+ \verbatim
+|   format (policy)   | from_float  |  to_float   |
+-------------------------------------------------
+|        Q15.8        | 0.99 / 0.37 | 0.84 / 0.21 |
+|  Q15.8 (saturation) | 1.31 / 0.37 | 0.84 / 0.21 |
+|  Q30.20 (exception) | 1.26 / 0.37 | 0.84 / 0.15 |
+|      UQ23.13.3      | 0.93 / 0.53 | 0.84 / 0.20 |
+|       Q62.30        | 0.99 / 0.39 | 0.84 / 0.13 |
+-------------------------------------------------
+\endverbatim
+ \note The stored integers of up to 31 bits are rounded within the 32-bit
+ lanes, the wider ones within the 64-bit lanes.
+ \note The conversions between the fixed-point formats (scalar/batch, ns):
+ \verbatim
+|       formats (policy)        | truncation  | round_half_even |
+---------------------------------------------------------------
+|       Q31.24 to Q15.12        | 1.21 / 0.06 |   1.90 / 0.14   |
+| Q31.24 to Q15.12 (saturation) | 1.55 / 0.07 |   2.32 / 0.15   |
+|  Q15.8 to Q30.20 (exception)  | 1.42 / 0.17 |   1.42 / 0.19   |
+|       Q62.30 to Q30.20        | 1.15 / 0.17 |   2.17 / 0.26   |
+---------------------------------------------------------------
+\endverbatim
+*/
+
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 4096u
+#define REPEATS 100u
+#define ROUNDS 20u
+
+
+/*!
+ \brief Gets the best time of the rounds since the timings of the noisy
+ machines are biased upwards only.
+*/
+template<typename Loop>
+double elapsed_per_element(Loop _loop) {
+    using namespace std::chrono;  // NOLINT
+
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t round = 0; round != ROUNDS; ++round) {
+        auto const start = steady_clock::now();
+        for (std::size_t k = 0; k != REPEATS; ++k) {
+            _loop();
+        }
+        auto const end = steady_clock::now();
+        duration<double, std::nano> const elapsed = end - start;
+
+        best = std::min(best, elapsed.count() / (N * REPEATS));
+    }
+
+    return best;
+}
+
+
+template<typename Q>
+void measure(char const* _name) {
+    // the samples are kept far from the range limits and from zero, so
+    // neither operation raises the events
+    double const high = 0.5 * std::sqrt(
+        static_cast<double>(std::numeric_limits<Q>::max()));
+    std::vector<Q> x(N), y(N), result(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        y[i] = Q(1.0 + high * i / N);
+        x[i] = Q(Q::is_signed ? 1.0 - high * i / N : 2.0 + high * i / N);
+    }
+
+    // the scalar loops are kept from being vectorized as the loops of the
+    // code using the library would be if these were not alone
+#define SCALAR(expression)\
+    elapsed_per_element([&] {\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            result[i] = expression;\
+        }\
+    })
+#define BATCH(call)\
+    elapsed_per_element([&] { call; })
+
+    std::cout
+        << _name << ": add "
+        << SCALAR(Q(x[i] + y[i])) << "/"
+        << BATCH(libq::batch::add<Q>(x, y, result)) << " ns, mul "
+        << SCALAR(Q(x[i] * y[i])) << "/"
+        << BATCH(libq::batch::mul<Q>(x, y, result)) << " ns, div "
+        << SCALAR(Q(x[i] / y[i])) << "/"
+        << BATCH(libq::batch::div<Q>(x, y, result)) << " ns, neg "
+        << SCALAR(-x[i]) << "/"
+        << BATCH(libq::batch::neg<Q>(x, result)) << " ns"
+        << std::endl;
+#undef BATCH
+#undef SCALAR
+}
+
+
+template<typename Q>
+void measure_reductions(char const* _name) {
+    std::vector<Q> x(N), y(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        x[i] = Q(std::sin(0.1 * i));
+        y[i] = Q(std::cos(0.1 * i));
+    }
+
+    // the scalar loops sum within format Q as std::inner_product does
+    Q result(0);
+#define SCALAR(expression)\
+    elapsed_per_element([&] {\
+        Q acc(0);\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            acc = expression;\
+        }\
+        result = acc;\
+    })
+#define BATCH(call)\
+    elapsed_per_element([&] { result = call; })
+
+    std::cout
+        << _name << ": sum "
+        << SCALAR(Q(acc + x[i])) << "/"
+        << BATCH(libq::sum<Q>(x)) << " ns, dot "
+        << SCALAR(Q(acc + x[i] * y[i])) << "/"
+        << BATCH(libq::dot<Q>(x, y)) << " ns"
+        << std::endl;
+#undef BATCH
+#undef SCALAR
+}
+
+
+template<typename Q>
+void measure_conversions(char const* _name) {
+    // the signs alternate as the samples of the sensors do
+    std::vector<float> x(N), y(N);
+    std::vector<Q> result(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        x[i] = static_cast<float>(std::sin(0.7 * i));
+    }
+
+#define SCALAR(to, expression)\
+    elapsed_per_element([&] {\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            to[i] = expression;\
+        }\
+    })
+#define BATCH(call)\
+    elapsed_per_element([&] { call; })
+
+    std::cout
+        << _name << ": from_float "
+        << SCALAR(result, Q(x[i])) << "/"
+        << BATCH(libq::batch::from_float<Q>(x, result)) << " ns, to_float "
+        << SCALAR(y, static_cast<float>(result[i])) << "/"
+        << BATCH(libq::batch::to_float<Q>(result, y)) << " ns"
+        << std::endl;
+#undef BATCH
+#undef SCALAR
+}
+
+
+template<typename Qdst, typename Qsrc>
+void measure_requantization(char const* _name) {
+    std::vector<Qsrc> x(N);
+    std::vector<Qdst> result(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        x[i] = Qsrc(std::sin(0.7 * i));
+    }
+
+#define SCALAR(Rounding)\
+    elapsed_per_element([&] {\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            result[i] = Qdst::template convert_from<Rounding>(x[i]);\
+        }\
+    })
+#define BATCH(Rounding)\
+    elapsed_per_element([&] {\
+        libq::batch::convert<Qdst, Qsrc, Rounding>(x, result);\
+    })
+
+    std::cout
+        << _name << ": truncation "
+        << SCALAR(libq::truncation) << "/"
+        << BATCH(libq::truncation) << " ns, round_half_even "
+        << SCALAR(libq::round_half_even) << "/"
+        << BATCH(libq::round_half_even) << " ns"
+        << std::endl;
+#undef BATCH
+#undef SCALAR
+}
+
+
+int main(int, char**) {
+    using libq::Q;
+    using libq::UQ;
+
+    using saturated = libq::saturation_policy;
+    using flagged = libq::overflow_flag_policy;
+    using thrown = libq::overflow_exception_policy;
+
+    measure<Q<15, 8> >("Q15.8");
+    measure<Q<15, 8, 0, saturated> >("Q15.8 (saturation)");
+    measure<Q<15, 8, 0, thrown> >("Q15.8 (exception)");
+    measure<Q<30, 20> >("Q30.20");
+    measure<Q<30, 20, 0, saturated> >("Q30.20 (saturation)");
+    measure<Q<30, 20, 0, flagged> >("Q30.20 (flag)");
+    measure<UQ<23, 13, 3> >("UQ23.13.3");
+    measure<Q<62, 30> >("Q62.30");
+
+    measure_reductions<Q<7, 5> >("Q7.5");
+    measure_reductions<Q<15, 8> >("Q15.8");
+    measure_reductions<Q<15, 8, 0, saturated> >("Q15.8 (saturation)");
+    measure_reductions<Q<30, 20> >("Q30.20");
+    measure_reductions<Q<31, 29> >("Q31.29");
+
+    measure_conversions<Q<15, 8> >("Q15.8");
+    measure_conversions<Q<15, 8, 0, saturated> >("Q15.8 (saturation)");
+    measure_conversions<Q<30, 20, 0, thrown> >("Q30.20 (exception)");
+    measure_conversions<UQ<23, 13, 3> >("UQ23.13.3");
+    measure_conversions<Q<62, 30> >("Q62.30");
+
+    measure_requantization<Q<15, 12>, Q<31, 24> >("Q31.24 to Q15.12");
+    measure_requantization<Q<15, 12, 0, saturated>, Q<31, 24, 0, saturated> >(  // NOLINT
+        "Q31.24 to Q15.12 (saturation)");
+    measure_requantization<Q<30, 20, 0, thrown>, Q<15, 8, 0, thrown> >(
+        "Q15.8 to Q30.20 (exception)");
+    measure_requantization<Q<30, 20>, Q<62, 30> >("Q62.30 to Q30.20");
+
+    return EXIT_SUCCESS;
+}
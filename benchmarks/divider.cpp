@@ -0,0 +1,120 @@
+// divider.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file divider.cpp
+
+ Measures the per-element cost of the division of the array by the same
+ divisor, i.e. operator/ against libq::divider.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o divider ./divider.cpp
+./divider
+\endverbatim
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0
+ (operator/ vs. divider, ns):
+ \verbatim
+|       format (policy)        |     div     |
+--------------------------------------------
+|            Q15.8             | 2.15 / 1.33 |
+|      Q15.8 (saturation)      | 2.16 / 2.08 |
+|            Q30.20            | 3.58 / 1.44 |
+| Q30.20 (overflow exceptions) | 3.58 / 1.77 |
+|          UQ23.13.3           | 3.58 / 1.43 |
+|            Q62.30            | 7.16 / 7.29 |
+--------------------------------------------
+\endverbatim
+ \note About 1 ns of each element is spent by the loop itself, i.e. by the
+ memory barrier keeping it scalar. The 32-bit division of Q15.8 is cheap on
+ this CPU, so is the gain. The products of Q62.30 do not fit 128 bits, so its
+ divider runs operator/.
+*/
+
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 4096u
+#define REPEATS 100u
+#define ROUNDS 20u
+
+
+/*!
+ \brief Gets the best time of the rounds since the timings of the noisy
+ machines are biased upwards only.
+*/
+template<typename Loop>
+double elapsed_per_element(Loop _loop) {
+    using namespace std::chrono;  // NOLINT
+
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t round = 0; round != ROUNDS; ++round) {
+        auto const start = steady_clock::now();
+        for (std::size_t k = 0; k != REPEATS; ++k) {
+            _loop();
+        }
+        auto const end = steady_clock::now();
+        duration<double, std::nano> const elapsed = end - start;
+
+        best = std::min(best, elapsed.count() / (N * REPEATS));
+    }
+
+    return best;
+}
+
+
+template<typename Q>
+void measure(char const* _name) {
+    // the quotients are kept within the range, so neither raises the events
+    double const high = 0.5 * std::sqrt(
+        static_cast<double>(std::numeric_limits<Q>::max()));
+    std::vector<Q> x(N), result(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        x[i] = Q(Q::is_signed ? 1.0 - high * i / N : 2.0 + high * i / N);
+    }
+    Q const divisor(3.0);
+    libq::divider<Q> const divider(divisor);
+
+#define LOOP(expression)\
+    elapsed_per_element([&] {\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            result[i] = expression;\
+        }\
+    })
+
+    std::cout
+        << _name << ": div "
+        << LOOP(Q(x[i] / divisor)) << "/"
+        << LOOP(Q(x[i] / divider)) << " ns"
+        << std::endl;
+#undef LOOP
+}
+
+
+int main(int, char**) {
+    using libq::Q;
+    using libq::UQ;
+
+    using saturated = libq::saturation_policy;
+    using thrown = libq::overflow_exception_policy;
+
+    measure<Q<15, 8> >("Q15.8");
+    measure<Q<15, 8, 0, saturated> >("Q15.8 (saturation)");
+    measure<Q<30, 20> >("Q30.20");
+    measure<Q<30, 20, 0, thrown> >("Q30.20 (overflow exceptions)");
+    measure<UQ<23, 13, 3> >("UQ23.13.3");
+    measure<Q<62, 30> >("Q62.30");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+// polar.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file polar.cpp
+
+ Measures the per-element cost of the polar coordinates of I/Q samples, i.e.
+ std::atan2 and std::hypot of the doubles against the ones of the
+ fixed-point numbers and libq::to_polar.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o polar ./polar.cpp
+./polar
+\endverbatim
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0
+ (doubles vs. std::atan2 + std::hypot vs. libq::to_polar, ns):
+ \verbatim
+| format |          polar          |
+------------------------------------
+| Q15.12 |  21.80 /  36.41 / 37.22 |
+| Q20.16 |  21.94 /  90.20 / 53.01 |
+| Q31.21 |  21.98 / 111.27 / 64.81 |
+------------------------------------
+\endverbatim
+*/
+
+#include <cstdlib>
+#include <cstdint>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 1024u
+#define REPEATS 20u
+#define ROUNDS 10u
+
+
+/*!
+ \brief Gets the best time of the rounds since the timings of the noisy
+ machines are biased upwards only.
+*/
+template<typename Loop>
+double elapsed_per_element(Loop _loop) {
+    using namespace std::chrono;  // NOLINT
+
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t round = 0; round != ROUNDS; ++round) {
+        auto const start = steady_clock::now();
+        for (std::size_t k = 0; k != REPEATS; ++k) {
+            _loop();
+        }
+        auto const end = steady_clock::now();
+        duration<double, std::nano> const elapsed = end - start;
+
+        best = std::min(best, elapsed.count() / (N * REPEATS));
+    }
+
+    return best;
+}
+
+
+template<typename Q>
+void measure(char const* _name) {
+    using magnitude_type = typename libq::details::hypot_of<Q>::promoted_type;
+    using angle_type = typename libq::details::atan2_of<Q>::promoted_type;
+
+    // the samples of the noisy tone, so the quadrants are not predictable
+    std::vector<Q> i_samples(N), q_samples(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        double const phase = 0.7 * i + 0.3 * ((i * 7919u) % 13u);
+
+        i_samples[i] = Q(3.0 * std::cos(phase));
+        q_samples[i] = Q(3.0 * std::sin(phase));
+    }
+    std::vector<magnitude_type> magnitude(N);
+    std::vector<angle_type> angle(N);
+
+#define LOOP(statement)\
+    elapsed_per_element([&] {\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            statement;\
+        }\
+    })
+
+    std::cout
+        << _name << ": polar "
+        << LOOP(magnitude[i] = magnitude_type(std::hypot(static_cast<double>(i_samples[i]), static_cast<double>(q_samples[i])));  /* NOLINT */
+                angle[i] = angle_type(std::atan2(static_cast<double>(q_samples[i]), static_cast<double>(i_samples[i])))) << "/"  /* NOLINT */
+        << LOOP(magnitude[i] = std::hypot(i_samples[i], q_samples[i]);
+                angle[i] = std::atan2(q_samples[i], i_samples[i])) << "/"
+        << LOOP(libq::to_polar(i_samples[i], q_samples[i], magnitude[i], angle[i]))  // NOLINT
+        << " ns"
+        << std::endl;
+#undef LOOP
+}
+
+
+int main(int, char**) {
+    using libq::Q;
+
+    measure<Q<15, 12> >("Q15.12");
+    measure<Q<20, 16> >("Q20.16");
+    measure<Q<31, 21> >("Q31.21");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+// sampled_checks.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sampled_checks.cpp
+
+ Measures the per-element cost of the arithmetics mixes of precision.cpp, i.e.
+ conversion from double, the four arithmetic operations and conversion back to
+ double, if the range checks are run for 1 in 64 operations only.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o sampled_checks ./sampled_checks.cpp
+./sampled_checks
+\endverbatim
+ \note Each mix makes 6 checked operations, i.e. 6 updates of the thread-local
+ counters. For the formats below the exact range checks are almost as cheap as
+ these updates, so the sampling saves little here. It pays off for the 64-bit
+ formats whose checks fall back to the word overflow tests.
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0:
+ \verbatim
+|  format   | ignorance (ns) | sampled 1/64 (ns) | every op (ns) |
+-----------------------------------------------------------------
+|  Q30.20   |      8.64      |       10.37       |     10.75     |
+| Q28.13.5  |      8.72      |       10.17       |     10.50     |
+| UQ23.13.3 |      9.32      |       10.59       |     10.09     |
+-----------------------------------------------------------------
+\endverbatim
+*/
+
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 4096u
+#define REPEATS 100u
+#define ROUNDS 40u
+
+
+double volatile sink;
+
+
+/*!
+ \brief Does what the precision tests do for every sample: the fixed-point
+ results are compared with the ones of double.
+*/
+template<typename Q>
+double mix(double const _x, double const _y) {
+    Q const a(_x);
+    Q const b(_y);
+
+    return std::fabs(static_cast<double>(a + b) - (_x + _y)) +
+           std::fabs(static_cast<double>(a - b) - (_x - _y)) +
+           std::fabs(static_cast<double>(a * b) - (_x * _y)) +
+           std::fabs(static_cast<double>(a / b) - (_x / _y));
+}
+
+
+/*!
+ \brief Gets the best time of the rounds since the timings of the noisy
+ machines are biased upwards only.
+*/
+template<typename Q>
+double elapsed_per_element(std::vector<double> const& _x,
+                           std::vector<double> const& _y) {
+    using namespace std::chrono;  // NOLINT
+
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t round = 0; round != ROUNDS; ++round) {
+        auto const start = steady_clock::now();
+        for (std::size_t k = 0; k != REPEATS; ++k) {
+            double result = 0.0;
+            for (std::size_t i = 0; i != N; ++i) {
+                result += mix<Q>(_x[i], _y[i]);
+            }
+            sink = result;
+        }
+        auto const end = steady_clock::now();
+        duration<double, std::nano> const elapsed = end - start;
+
+        best = std::min(best, elapsed.count() / (N * REPEATS));
+    }
+
+    return best;
+}
+
+
+using sampled_op = libq::sampling_policy<libq::overflow_exception_policy, 64u>;
+using sampled_up = libq::sampling_policy<libq::underflow_exception_policy, 64u>;
+using checked_op = libq::overflow_exception_policy;
+using checked_up = libq::underflow_exception_policy;
+
+
+template<typename ignored_Q, typename sampled_Q, typename checked_Q>
+void measure(char const* _name) {
+    // the samples are kept far from the range limits and from zero, so
+    // neither of the checks raises
+    double const high = 0.5 * std::sqrt(
+        static_cast<double>(std::numeric_limits<ignored_Q>::max()));
+    std::vector<double> x(N), y(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        y[i] = 1.0 + high * i / N;
+        x[i] = ignored_Q::is_signed ? 1.0 - high * i / N : 1.0 + y[i];
+    }
+
+    std::cout
+        << _name
+        << ": ignorance " << elapsed_per_element<ignored_Q>(x, y)
+        << " ns, sampled " << elapsed_per_element<sampled_Q>(x, y)
+        << " ns, every op " << elapsed_per_element<checked_Q>(x, y) << " ns"
+        << std::endl;
+}
+
+
+int main(int, char**) {
+    using libq::Q;
+    using libq::UQ;
+
+    measure<Q<30, 20>,
+            Q<30, 20, 0, sampled_op, sampled_up>,
+            Q<30, 20, 0, checked_op, checked_up> >("Q30.20");
+    measure<Q<28, 13, 5>,
+            Q<28, 13, 5, sampled_op, sampled_up>,
+            Q<28, 13, 5, checked_op, checked_up> >("Q28.13.5");
+    measure<UQ<23, 13, 3>,
+            UQ<23, 13, 3, sampled_op, sampled_up>,
+            UQ<23, 13, 3, checked_op, checked_up> >("UQ23.13.3");
+
+    return EXIT_SUCCESS;
+}
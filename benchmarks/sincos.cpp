@@ -0,0 +1,106 @@
+// sincos.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sincos.cpp
+
+ Measures the per-element cost of sin and cos of the same angle, i.e.
+ std::sin with std::cos against libq::sincos.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o sincos ./sincos.cpp
+./sincos
+\endverbatim
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0
+ (std::sin + std::cos vs. libq::sincos, ns):
+ \verbatim
+|       format (policy)        |     sincos      |
+-------------------------------------------------
+|            Q15.12            |  49.24 / 18.56  |
+|            Q20.16            |  53.88 / 18.51  |
+|            Q31.21            | 183.87 / 78.12  |
+| Q31.21 (overflow exceptions) | 270.44 / 138.62 |
+-------------------------------------------------
+\endverbatim
+*/
+
+#include <cstdlib>
+#include <cstdint>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 1024u
+#define REPEATS 20u
+#define ROUNDS 10u
+
+
+/*!
+ \brief Gets the best time of the rounds since the timings of the noisy
+ machines are biased upwards only.
+*/
+template<typename Loop>
+double elapsed_per_element(Loop _loop) {
+    using namespace std::chrono;  // NOLINT
+
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t round = 0; round != ROUNDS; ++round) {
+        auto const start = steady_clock::now();
+        for (std::size_t k = 0; k != REPEATS; ++k) {
+            _loop();
+        }
+        auto const end = steady_clock::now();
+        duration<double, std::nano> const elapsed = end - start;
+
+        best = std::min(best, elapsed.count() / (N * REPEATS));
+    }
+
+    return best;
+}
+
+
+template<typename Q>
+void measure(char const* _name) {
+    using result_type = typename libq::details::sin_of<Q>::promoted_type;
+
+    std::vector<Q> x(N);
+    for (std::size_t i = 0; i != N; ++i) {
+        x[i] = Q(-6.0 + 12.0 * i / N);
+    }
+    std::vector<result_type> sin(N), cos(N);
+
+#define LOOP(statement)\
+    elapsed_per_element([&] {\
+        for (std::size_t i = 0; i != N; ++i) {\
+            asm volatile("" ::: "memory");\
+            statement;\
+        }\
+    })
+
+    std::cout
+        << _name << ": sincos "
+        << LOOP(sin[i] = std::sin(x[i]); cos[i] = std::cos(x[i])) << "/"
+        << LOOP(libq::sincos(x[i], sin[i], cos[i])) << " ns"
+        << std::endl;
+#undef LOOP
+}
+
+
+int main(int, char**) {
+    using libq::Q;
+
+    measure<Q<15, 12> >("Q15.12");
+    measure<Q<20, 16> >("Q20.16");
+    measure<Q<31, 21> >("Q31.21");
+    measure<Q<31, 21, 0, libq::overflow_exception_policy> >(
+        "Q31.21 (overflow exceptions)");
+
+    return EXIT_SUCCESS;
+}
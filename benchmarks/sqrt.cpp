@@ -0,0 +1,89 @@
+// sqrt.cpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sqrt.cpp
+
+ Measures the per-call cost of CORDIC-based std::sqrt for fixed-point numbers
+ against std::sqrt for double.
+
+ \verbatim
+g++ -std=gnu++11 -O3 -DIMPLICIT_COPY_CTR -I.. -o sqrt ./sqrt.cpp
+./sqrt
+\endverbatim
+ \note The reference points for x64 Intel(R) Xeon(R), g++ ver. 12.2.0:
+ \verbatim
+|  format  | LUT built per call (ns) | precomputed LUT/norm (ns) |
+---------------------------------------------------------------
+|  double  |          2.6            |           2.6             |
+| UQ32.20  |         1494            |            75             |
+| UQ23.17  |         1187            |            66             |
+---------------------------------------------------------------
+\endverbatim
+*/
+
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "libq/fixed_point.hpp"
+
+#define N 10000000ul
+
+
+double volatile double_sink;
+std::uintmax_t volatile fixed_point_sink;
+
+void consume(double const _x) {
+    double_sink = _x;
+}
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+void consume(libq::fixed_point<T, n, f, e, op, up> const& _x) {
+    fixed_point_sink = static_cast<std::uintmax_t>(_x.value());
+}
+
+
+template<typename Value_type>
+double elapsed_per_call(std::vector<Value_type> const& _samples) {
+    using namespace std::chrono;  // NOLINT
+
+    auto const start = steady_clock::now();
+    for (std::uintmax_t i = 0; i != N; ++i) {
+        consume(std::sqrt(_samples[i & 1023u]));
+    }
+    auto const end = steady_clock::now();
+    duration<double, std::nano> const elapsed = end - start;
+
+    return elapsed.count() / N;
+}
+
+
+int main(int, char**) {
+    using Q1 = libq::UQ<32, 20>;
+    using Q2 = libq::UQ<23, 17>;
+
+    std::vector<double> samples(1024u);
+    for (std::size_t i = 0; i != samples.size(); ++i) {
+        samples[i] = 0.25 + 0.0625 * i;
+    }
+
+    std::vector<Q1> const samples1(samples.cbegin(), samples.cend());
+    std::vector<Q2> const samples2(samples.cbegin(), samples.cend());
+
+    std::cout
+        << "double:  " << elapsed_per_call(samples)
+        << " ns/call" << std::endl
+        << "UQ32.20: " << elapsed_per_call(samples1)
+        << " ns/call" << std::endl
+        << "UQ23.17: " << elapsed_per_call(samples2)
+        << " ns/call" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -112,8 +112,8 @@ typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promote
     _val = std::fabs(_val);
 
 
-    static lut_type const angles = lut_type::circular();
-    static lut_type const scales = lut_type::circular_scales();
+    constexpr lut_type angles = lut_type::circular();
+    constexpr lut_type scales = lut_type::circular_scales();
 
     // rotation mode: see page 6
     // shift sequence is just 0, 1, ... (circular coordinate system)
@@ -133,8 +133,8 @@ typename libq::details::acos_of<libq::fixed_point<T, n, f, e, op, up> >::promote
         }
 
         typename result_type::storage_type const storage(x.value());
-        x = x - result_type::wrap(sign * (y.value() >> i));
-        y = y + result_type::wrap(sign * (storage >> i));
+        x = x - result_type::wrap(sign * result_type::rounding_mode::shift_right(y.value(), i));  // NOLINT
+        y = y + result_type::wrap(sign * result_type::rounding_mode::shift_right(storage, i));  // NOLINT
         z = (sign > 0)? z + angles[i] : z - angles[i];
         _val = _val * scales[i];  // multiply by square of K(n)
     };  // NOLINT
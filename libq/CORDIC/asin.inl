@@ -60,8 +60,8 @@ typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promote
     } else if (_val == Q(0.0)) {
         return result_type::wrap(0);
     }
-    static lut_type const angles = lut_type::circular();
-    static lut_type const scales = lut_type::circular_scales();
+    constexpr lut_type angles = lut_type::circular();
+    constexpr lut_type scales = lut_type::circular_scales();
 
     // rotation mode: see page 6
     // shift sequence is just 0, 1, ... (circular coordinate system)
@@ -80,8 +80,8 @@ typename libq::details::asin_of<libq::fixed_point<T, n, f, e, op, up> >::promote
         }
 
         typename result_type::storage_type const store(x.value());
-        x = x - result_type::wrap(sign * (y.value() >> i));
-        y = y + result_type::wrap(sign * (store >> i));
+        x = x - result_type::wrap(sign * result_type::rounding_mode::shift_right(y.value(), i));  // NOLINT
+        y = y + result_type::wrap(sign * result_type::rounding_mode::shift_right(store, i));  // NOLINT
         z = (sign > 0)? z + angles[i] : z - angles[i];
         _val = _val * scales[i];
     };  // NOLINT
@@ -42,7 +42,7 @@ typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promote
         typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
     using lut_type = libq::cordic::lut<f, Q>;
 
-    static lut_type const angles = lut_type::circular();
+    constexpr lut_type angles = lut_type::circular();
 
     // vectoring mode: see page 10, table 24.2
     // shift sequence is just 0, 1, ... (circular coordinate system)
@@ -57,8 +57,8 @@ typename libq::details::atan_of<libq::fixed_point<T, n, f, e, op, up> >::promote
             ((y.value() > 0)? +1 : -1);
 
         typename result_type::storage_type const store(x.value());
-        x = x + result_type::wrap(sign * (y.value() >> i));
-        y = y - result_type::wrap(sign * (store >> i));
+        x = x + result_type::wrap(sign * result_type::rounding_mode::shift_right(y.value(), i));  // NOLINT
+        y = y - result_type::wrap(sign * result_type::rounding_mode::shift_right(store, i));  // NOLINT
         z = (sign > 0)? z + angles[i] : z - angles[i];
     };  // NOLINT
 #ifdef LOOP_UNROLLING
@@ -0,0 +1,225 @@
+// atan2.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file atan2.inl
+
+ Provides CORDIC for atan2 function, i.e. the angle of the vector (x, y) got
+ by one rotation in vectoring mode, see also hypot.inl and polar.inl
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_STD_ATAN2_INL_
+#define INC_STD_ATAN2_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief
+*/
+template<typename T>
+class atan2_of {
+ public:
+    using promoted_type = T;
+};
+
+// the angles are within [-pi, pi], so two integral bits are needed
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class atan2_of<libq::fixed_point<T, n, f, e, op, up> >
+    : private libq::fixed_point<T, 0, f, e, op, up>,
+      public type_promotion_base<
+          libq::fixed_point<typename std::make_signed<T>::type, 0, f, e, op, up>,  // NOLINT
+          2u,
+          0,
+          0> {
+};
+
+
+/*!
+ \brief Gets the angle and the magnitude of the vector (x, y) by one CORDIC
+ rotation in vectoring mode, i.e. y is driven to zero while the angles of
+ rotations are summed up.
+ \note The vectors of the left half-plane are rotated by pi beforehand, so
+ the rotations converge for every quadrant: see page 10, table 24.2. The
+ stored integers are negated by the sign masks, so the iterations have no
+ branches mispredicted on the signs of samples.
+ \note The vector is shifted to the left by the leading zero bits of |x| and
+ |y| beforehand, so the shifts of the small vectors do not vanish within few
+ iterations. The magnitude is shifted back once it is rounded.
+ \note The vectors (x, 0) are not rotated at all, so the angles are exactly
+ 0 or pi and the magnitude is |x|.
+*/
+template<typename Q>
+class circular_vectoring;
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class circular_vectoring<libq::fixed_point<T, n, f, e, op, up> > {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+
+    enum: std::size_t {
+        // the residual angle of f + 3 rotations is below 2^-(f + 2), and the
+        // rounding errors of up to 2^6 rotations are dropped by the guard
+        // bits
+        guard_bits = (n + f + 9u <= std::numeric_limits<libq::details::largest_signed_word>::digits) ? 6u : 0u,  // NOLINT
+        iterations = f + 3u,
+        work_bits = f + guard_bits,
+        top_bits = n + work_bits
+    };
+
+ public:
+    // two bits are needed for the gain of rotations and for the magnitude
+    // of up to sqrt(2) * 2^n
+    using work_type = libq::Q<n + work_bits + 2u, work_bits, e, op, up>;
+    using angle_type = libq::Q<work_bits + 3u, work_bits, e, op, up>;
+
+    circular_vectoring(Q const& _x, Q const& _y)
+        : m_magnitude(0),
+          m_angle(0),
+          m_shifts(0u) {
+        using storage_type = typename work_type::storage_type;
+        using angle_storage_type = typename angle_type::storage_type;
+
+        storage_type const x_mask = -static_cast<storage_type>(_x.value() < 0);  // NOLINT
+        storage_type const y_mask = -static_cast<storage_type>(_y.value() < 0);  // NOLINT
+        storage_type x = (libq::details::shift_left(static_cast<storage_type>(_x.value()), guard_bits) ^ x_mask) - x_mask;  // NOLINT
+        storage_type y = (libq::details::shift_left(static_cast<storage_type>(_y.value()), guard_bits) ^ x_mask) - x_mask;  // NOLINT
+
+        // the magnitudes of x and y are up to 2^(n + f + guard_bits). y is
+        // already negated in the left half-plane, so its sign is of both masks
+        storage_type const sign_of_y = x_mask ^ y_mask;
+        this->m_shifts = top_bits - std::min<std::size_t>(
+            libq::details::bit_length(x | ((y ^ sign_of_y) - sign_of_y)),
+            top_bits);
+        x = libq::details::shift_left(x, this->m_shifts);
+        y = libq::details::shift_left(y, this->m_shifts);
+
+        // the vectors of the left half-plane are rotated by pi of the sign
+        // of y
+        angle_storage_type const pi = angle_type::CONST_PI.value();
+        angle_storage_type z = static_cast<angle_storage_type>(x_mask) &
+            ((pi ^ static_cast<angle_storage_type>(y_mask)) -
+                static_cast<angle_storage_type>(y_mask));
+
+        if (y == 0) {
+            this->m_magnitude = x;
+            this->m_angle = z;
+
+            return;
+        }
+
+        using lut_type = libq::cordic::lut<iterations, angle_type>;
+        constexpr lut_type angles = lut_type::circular();
+
+#ifdef LOOP_UNROLLING
+        auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+        for (std::size_t i = 0u; i != iterations; ++i) {
+#endif
+            storage_type const mask = -static_cast<storage_type>(y < 0);
+            storage_type const x_scaled = work_type::rounding_mode::shift_right(x, i);  // NOLINT
+            storage_type const y_scaled = work_type::rounding_mode::shift_right(y, i);  // NOLINT
+            angle_storage_type const angle_mask =
+                static_cast<angle_storage_type>(mask);
+
+            x = x + ((y_scaled ^ mask) - mask);
+            y = y - ((x_scaled ^ mask) - mask);
+            z = z + ((angles.value(i) ^ angle_mask) - angle_mask);
+        };  // NOLINT
+#ifdef LOOP_UNROLLING
+        libq::details::unroll(iteration_body,
+                              0u,
+                              libq::details::loop_size<iterations-1>());
+#endif
+
+        this->m_magnitude = circular_vectoring::normalized(x);
+        this->m_angle = z;
+    }
+
+    /*!
+     \brief Gets the angle of the vector within [-pi, pi] as the number of
+     format R.
+    */
+    template<typename R>
+    R angle() const {
+        return R::wrap(circular_vectoring::rounded<R>(this->m_angle, 0u));
+    }
+
+    /*!
+     \brief Gets the magnitude of the vector as the number of format R. The
+     numbers beyond the range of R are reported as the overflow policy of R
+     says.
+    */
+    template<typename R>
+    R magnitude() const {
+        return R::wrap(circular_vectoring::rounded<R>(this->m_magnitude,
+                                                      this->m_shifts));
+    }
+
+ private:
+    using word_type = libq::details::largest_signed_word;
+
+    /*!
+     \brief Divides x by the gain of rotations, see page 10, table 24.1. The
+     reciprocal of the gain has as many bits as x has unless the product
+     does not fit the word.
+    */
+    static word_type normalized(typename work_type::storage_type const _x) {
+        enum: std::size_t {
+            x_bits = work_type::number_of_significant_bits + 1u,
+            norm_bits =
+                (x_bits + x_bits <= std::numeric_limits<word_type>::digits) ?
+                    x_bits :
+                    std::numeric_limits<word_type>::digits - x_bits
+        };
+        using norm_type = libq::Q<norm_bits, norm_bits>;
+        using product_type =
+            typename libq::details::exact_word_of<x_bits + norm_bits>::type;
+
+        static constexpr typename norm_type::storage_type norm_factor =
+            libq::details::constexpr_math::to_stored_integer<norm_type>(
+                1.0 / libq::cordic::lut<iterations, work_type>::circular_scale(iterations));  // NOLINT
+
+        return static_cast<word_type>(
+            (static_cast<product_type>(_x) * static_cast<product_type>(norm_factor) +  // NOLINT
+                (product_type(1) << (norm_bits - 1u))) >> norm_bits);
+    }
+
+    /*!
+     \brief Drops the guard bits and the given shifts of the stored integer,
+     i.e. rounds it to nearest once.
+    */
+    template<typename R>
+    static word_type rounded(word_type const _x, std::size_t const _shifts) {
+        static_assert(R::bits_for_fractional == f &&
+                      R::scaling_factor_exponent == e,
+                      "the result is not of the scale of the rotation");
+
+        return
+            (_x + ((word_type(1) << (guard_bits + _shifts)) >> 1)) >>
+                (guard_bits + _shifts);
+    }
+
+    word_type m_magnitude;
+    word_type m_angle;
+    std::size_t m_shifts;
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::atan2_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    atan2(libq::fixed_point<T, n, f, e, op, up> _y,
+          libq::fixed_point<T, n, f, e, op, up> _x) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using atan2_type = typename libq::details::atan2_of<Q>::promoted_type;
+
+    return
+        libq::details::circular_vectoring<Q>(_x, _y).template angle<atan2_type>();  // NOLINT
+}
+}  // namespace std
+
+#endif  // INC_STD_ATAN2_INL_
@@ -6,7 +6,8 @@
 /*!
  \file cosh.inl
 
- Provides CORDIC for cosh function as a sum of exponents
+ Provides CORDIC for cosh function as a half-sum of exponents got by one
+ rotation in hyperbolic coordinates, see sinh.inl
 
  \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures" and
  J.S. Walther, "A Unified Algorithm for Elementary Functions"
@@ -22,11 +23,8 @@ typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promote
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using cosh_type = typename libq::details::sinh_of<Q>::promoted_type;
 
-    auto x = static_cast<cosh_type>(std::exp(_val)) +
-        static_cast<cosh_type>(std::exp(-_val));
-    libq::lift(x) >>= 1u;
-
-    return x;
+    return
+        libq::details::hyperbolic_rotation<Q>(_val).template cosh<cosh_type>();  // NOLINT
 }
 }  // namespace std
 
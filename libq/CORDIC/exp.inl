@@ -38,61 +38,106 @@ class exp_of<libq::fixed_point<T, n, f, e, op, up> > {
                                op,
                                up>;
 };
-}  // namespace details
-}  // namespace libq
 
-namespace std {
+
+/*!
+ \brief Computes \f$2^{k + r}\f$ of the integral part k and the fractional
+ part \f$0 \le r < 1\f$ of the exponent. \f$2^r\f$ is the product of the LUT
+ entries \f$2^{2^{-(i + 1)}}\f$ for the set bits of r, and it is shifted by
+ k bits.
+*/
+template<typename Q>
+class power_of_two;
+
 template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
-typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
-    exp(libq::fixed_point<T, n, f, e, op, up> _val) {
+class power_of_two<libq::fixed_point<T, n, f, e, op, up> > {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
-    using exp_type = typename libq::details::exp_of<Q>::promoted_type;
-
-    using Qw = libq::Q<f, f, e, op, up>;
-    using work_type =
-        typename libq::details::type_promotion_base<Qw, 1u, 0, 0>::promoted_type;  // NOLINT
-    using lut_type = libq::cordic::lut<f, work_type>;
-
-    // reduces argument to interval [0.0, 1.0]
-    int power(0);
-    typename libq::details::mult_of<Q, work_type>::promoted_type
-        arg(_val * work_type::CONST_LOG2E);
-    while (arg >= exp_type(1.0)) {
-        arg = arg - 1u;
-        power++;
-    }
-    while (arg < exp_type(0.0)) {
-        arg = arg + 1u;
-        power--;
+
+ public:
+    using work_type = libq::Q<f + 1u, f, e, op, up>;
+    using result_type = typename exp_of<Q>::promoted_type;
+
+    /*!
+     \brief Computes 2 to the power of the fixed-point number of format S.
+     \note The integral part is the stored integer shifted to the right and
+     the fractional part is its masked low bits, so the reduction takes the
+     same time whatever the exponent is.
+    */
+    template<typename S>
+    static result_type of(S const& _exponent) {
+        using storage_type = typename S::storage_type;
+        enum: int {
+            bits = static_cast<int>(S::bits_for_fractional) +
+                   S::scaling_factor_exponent
+        };
+        static_assert(bits >= 0 &&
+                      bits < std::numeric_limits<storage_type>::digits,
+                      "the integral part of the exponent is not a shift of it");  // NOLINT
+
+        storage_type const mask =
+            static_cast<storage_type>((storage_type(1) << bits) - 1);
+
+        return
+            power_of_two::of(
+                static_cast<int>(_exponent.value() >> bits),
+                work_type(S::wrap(static_cast<storage_type>(_exponent.value() & mask))));  // NOLINT
     }
 
-    static lut_type const pow2_lut = lut_type::pow2();
-    exp_type result(1.0);
-    work_type x(arg);
+ private:
+    static result_type of(int const _power, work_type _fraction) {
+        using lut_type = libq::cordic::lut<f, work_type>;
+
+        constexpr lut_type pow2_lut = lut_type::pow2();
+        result_type result(1.0);
 
 #ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
+        auto const iteration_body = [&](std::size_t i) {  // NOLINT
 #else
-    for (std::size_t i = 0u; i != f; ++i) {
+        for (std::size_t i = 0u; i != f; ++i) {
 #endif
-        work_type const pow2 = work_type::wrap(T(1u) << (f - i - 1u));
+            work_type const pow2 = work_type::wrap(T(1u) << (f - i - 1u));
 
-        if (x - pow2 >= work_type(0.0)) {
-            x = x - pow2;
+            if (_fraction - pow2 >= work_type(0.0)) {
+                _fraction = _fraction - pow2;
 
-            result *= pow2_lut[i];
-        }
-    };  // NOLINT
+                result *= pow2_lut[i];
+            }
+        };  // NOLINT
 #ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
+        libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());  // NOLINT
 #endif
 
-    if (power >= 0) {
-        libq::lift(result) <<= power;
-    } else {
-        libq::lift(result) >>= (-power);
+        // the bits shifted by the whole width are dropped, i.e. the powers
+        // far below zero are zero
+        enum: int {
+            digits = std::numeric_limits<typename result_type::storage_type>::digits  // NOLINT
+        };
+        if (_power >= 0) {
+            libq::lift(result) = (_power < digits) ?
+                (libq::lift(result) << _power) : 0u;
+        } else {
+            libq::lift(result) = (-_power < digits) ?
+                (libq::lift(result) >> (-_power)) : 0u;
+        }
+        return result;
     }
-    return result;
+};
+}  // namespace details
+}  // namespace libq
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    exp(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using work_type = typename libq::details::power_of_two<Q>::work_type;
+    using scaled_type =
+        typename libq::details::mult_of<Q, work_type>::promoted_type;
+
+    // exp(x) = 2^(x * log2(e))
+    return
+        libq::details::power_of_two<Q>::of(
+            scaled_type(_val * work_type::CONST_LOG2E));
 }
 }  // namespace std
 
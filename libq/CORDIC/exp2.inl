@@ -0,0 +1,29 @@
+// exp2.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file exp2.inl
+
+ Provides CORDIC for exp2 function, i.e. std::exp without the multiplication
+ by log2(e), see exp.inl
+
+ \ref see C. Baumann, "A simple and fast look-up table method to compute the
+ exp(x) and ln(x) functions", 2004
+*/
+
+#ifndef INC_LIBQ_DETAILS_EXP2_INL_
+#define INC_LIBQ_DETAILS_EXP2_INL_
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::exp_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    exp2(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+
+    return libq::details::power_of_two<Q>::of(_val);
+}
+}  // namespace std
+
+#endif  // INC_LIBQ_DETAILS_EXP2_INL_
@@ -0,0 +1,56 @@
+// hypot.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file hypot.inl
+
+ Provides CORDIC for hypot function, i.e. the magnitude of the vector (x, y)
+ got by one rotation in vectoring mode, see atan2.inl
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_STD_HYPOT_INL_
+#define INC_STD_HYPOT_INL_
+
+namespace libq {
+namespace details {
+/*!
+ \brief
+*/
+template<typename T>
+class hypot_of {
+ public:
+    using promoted_type = T;
+};
+
+// the magnitude is up to sqrt(2) times the greatest number.
+// trick: an extra base class is required to make the compiler to
+// instantiate the class representing the fixed-point number of a new format
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class hypot_of<libq::fixed_point<T, n, f, e, op, up> >
+    : private libq::fixed_point<T, n, f, e, op, up>,
+      public type_promotion_base<libq::fixed_point<T, n, f, e, op, up>,
+                                 1u,
+                                 0,
+                                 0> {
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::hypot_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    hypot(libq::fixed_point<T, n, f, e, op, up> _x,
+          libq::fixed_point<T, n, f, e, op, up> _y) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using hypot_type = typename libq::details::hypot_of<Q>::promoted_type;
+
+    return
+        libq::details::circular_vectoring<Q>(_x, _y).template magnitude<hypot_type>();  // NOLINT
+}
+}  // namespace std
+
+#endif  // INC_STD_HYPOT_INL_
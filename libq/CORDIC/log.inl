@@ -72,7 +72,7 @@ typename libq::details::log_of<T, n, f, e, op, up>::promoted_type
     // so CORDIC rotation is just a multiplication by 2^{1/2^i}:
     // 2^y = 2^{a1/2} * 2^{a2/4} * ... * 2^{ai/2^i}, where ai is from
     // {0, 1}
-    static libq::cordic::lut<f, Q> const inv_pow2_lut = lut::inv_pow2();
+    constexpr lut inv_pow2_lut = lut::inv_pow2();
 
     work_type result(0);
 
@@ -14,25 +14,29 @@
 #define INC_LIBQ_CORDIC_ARCTAN_LUT_INL_
 
 namespace libq {
-namespace cordic {
-
+namespace details {
 /*!
- \ref See page 5, equation 7, m = 1 (circular coordinate system).
+ \brief Generates the angles \f$\arctan 2^{-i}\f$.
 */
-template<std::size_t n, typename Q>
-lut<n, Q> lut<n, Q>::circular() {
-    base_class table;
-
+struct arctan_generator {
     // shift sequence is just 0, 1, 2, 3, ..., i, ...
     // see page 10, table 24.1, m = 1
-    for (std::size_t i = 0; i != n; ++i) {
-        double const val = std::atan(1.0 / std::pow(2.0,
-                                                    static_cast<double>(i)));
-
-        table[i] = Q(val);
+    static constexpr double value(std::size_t _i) {
+        return constexpr_math::atan(
+                                constexpr_math::pow2(-static_cast<int>(_i)));
     }
+};
+}  // namespace details
+
 
-    return this_class(table);
+namespace cordic {
+
+/*!
+ \ref See page 5, equation 7, m = 1 (circular coordinate system).
+*/
+template<std::size_t n, typename Q>
+constexpr lut<n, Q> lut<n, Q>::circular() {
+    return this_class::generate<libq::details::arctan_generator>();
 }
 }  // namespace cordic
 }  // namespace libq
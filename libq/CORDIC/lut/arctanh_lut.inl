@@ -14,25 +14,30 @@
 #define INC_LIBQ_CORDIC_ARCTANH_LUT_INL_
 
 namespace libq {
-namespace cordic {
-
+namespace details {
 /*!
- \ref See page 5, equation 7, m = -1 (hyperbolic coordinate system).
+ \brief Generates the angles \f$\mathrm{arctanh} 2^{-(i+1)}\f$.
 */
-template<size_t n, typename Q>
-lut<n, Q> lut<n, Q>::hyperbolic_wo_repeated_iterations() {
-    base_class table;
-
+struct arctanh_generator {
     // Shift sequence is 1, 2, 3, ..., i, ... united with (3k + 1, k = 1,2,...).
     // But LUT uses only 1, 2, 3 ,... sequence.
     // see page 10, table 24.1, m = -1
-    for (std::size_t i = 0; i != n; ++i) {
-        double const arg = 1.0 / std::pow(2.0, static_cast<double>(i + 1u));
-
-        table[i] = Q(-0.5 * std::log(1 - arg) + 0.5 * std::log(1 + arg));
+    static constexpr double value(std::size_t _i) {
+        return constexpr_math::atanh(
+                           constexpr_math::pow2(-static_cast<int>(_i + 1u)));
     }
+};
+}  // namespace details
+
 
-    return this_class(table);
+namespace cordic {
+
+/*!
+ \ref See page 5, equation 7, m = -1 (hyperbolic coordinate system).
+*/
+template<size_t n, typename Q>
+constexpr lut<n, Q> lut<n, Q>::hyperbolic_wo_repeated_iterations() {
+    return this_class::generate<libq::details::arctanh_generator>();
 }
 }  // namespace cordic
 }  // namespace libq
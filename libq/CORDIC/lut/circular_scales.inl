@@ -13,33 +13,36 @@
 #define INC_LIBQ_CORDIC_CIRCULAR_SCALES_INL_
 
 namespace libq {
-namespace cordic {
-
+namespace details {
 /*!
+ \brief Generates the scales \f$\sqrt{1 + 2^{-2i}}\f$ of CORDIC-rotations.
 */
-template<std::size_t n, typename Q>
-double lut<n, Q>::circular_scale(std::size_t _n) {
-    double scale(1.0);
-
-    for (std::size_t i = 0; i != _n; ++i) {
-        scale *= std::sqrt(1.0 + std::pow(2.0, -2.0 * i));
+struct circular_scale_generator {
+    static constexpr double value(std::size_t _i) {
+        return constexpr_math::sqrt(
+                    1.0 + constexpr_math::pow2(-2 * static_cast<int>(_i)));
     }
+};
+}  // namespace details
 
-    return scale;
-}
 
+namespace cordic {
 
 /*!
 */
 template<std::size_t n, typename Q>
-lut<n, Q> lut<n, Q>::circular_scales() {
-    base_class scales;
+constexpr double lut<n, Q>::circular_scale(std::size_t _n) {
+    return (_n == 0u) ? 1.0 :
+        this_class::circular_scale(_n - 1u) *
+            libq::details::circular_scale_generator::value(_n - 1u);
+}
 
-    for (std::size_t i = 0; i != n; ++i) {
-        scales[i] = std::sqrt(1.0 + std::pow(2.0, -2.0 * i));
-    }
 
-    return this_class(scales);
+/*!
+*/
+template<std::size_t n, typename Q>
+constexpr lut<n, Q> lut<n, Q>::circular_scales() {
+    return this_class::generate<libq::details::circular_scale_generator>();
 }
 }  // namespace cordic
 }  // namespace libq
@@ -14,26 +14,52 @@
 #define INC_LIBQ_CORDIC_HYPERBOLIC_SCALE_INL_
 
 namespace libq {
+namespace details {
+/*!
+ \brief Generates the scales \f$\sqrt{1 - 2^{-2i}}\f$ of CORDIC-rotations.
+*/
+struct hyperbolic_scale_generator {
+    static constexpr double value(std::size_t _i) {
+        return constexpr_math::sqrt(
+                    1.0 - constexpr_math::pow2(-2 * static_cast<int>(_i)));
+    }
+};
+}  // namespace details
+
+
 namespace cordic {
 
 /*!
 */
 template<std::size_t n, typename Q>
-double lut<n, Q>::hyperbolic_scale_with_repeated_iterations(std::size_t _n) {
-    double scale(1.0);
-
-    std::size_t repeated(4u);
-    for (std::size_t i = 1u; i != _n; ++i) {
-        scale *= std::sqrt(1.0 - std::pow(2.0, -2.0 * i));
+constexpr double
+    lut<n, Q>::hyperbolic_scale_with_repeated_iterations(std::size_t _n) {
+    return this_class::hyperbolic_scale_from(1u, _n, 4u, 1.0);
+}
 
-        if (i == repeated && i != _n - 1) {
-            scale *= std::sqrt(1.0 - std::pow(2.0, -2.0 * i++));
 
-            repeated = 3u * repeated  + 1u;
-        }
-    }
+/*!
+ \brief Accumulates the scale starting from the rotation by the shift. The
+ rotations by shifts 4, 13, 40, ..., 3k + 1 are repeated.
+*/
+template<std::size_t n, typename Q>
+constexpr double lut<n, Q>::hyperbolic_scale_from(std::size_t _shift,
+                                                  std::size_t _n,
+                                                  std::size_t _repeated,
+                                                  double _scale) {
+    using generator = libq::details::hyperbolic_scale_generator;
 
-    return scale;
+    return (_shift > _n) ? _scale :
+        (_shift == _repeated) ?
+            this_class::hyperbolic_scale_from(_shift + 1u,
+                                              _n,
+                                              3u * _repeated + 1u,
+                                              _scale * generator::value(_shift) *  // NOLINT
+                                                  generator::value(_shift)) :
+            this_class::hyperbolic_scale_from(_shift + 1u,
+                                              _n,
+                                              _repeated,
+                                              _scale * generator::value(_shift));  // NOLINT
 }
 }  // namespace cordic
 }  // namespace libq
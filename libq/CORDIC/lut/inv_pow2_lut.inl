@@ -13,19 +13,26 @@
 #define INC_LIBQ_CORDIC_INV_POW2_LUT_INL_
 
 namespace libq {
+namespace details {
+/*!
+ \brief Generates the values \f$\frac1{2^{2^{-(i+1)}}}\f$.
+*/
+struct inv_pow2_generator {
+    static constexpr double value(std::size_t _i) {
+        return constexpr_math::exp(-0.693147180559945309417 *
+                           constexpr_math::pow2(-static_cast<int>(_i + 1u)));
+    }
+};
+}  // namespace details
+
+
 namespace cordic {
 
 /*!
 */
 template<std::size_t n, typename Q>
-lut<n, Q> lut<n, Q>::inv_pow2() {
-    base_class table;
-
-    for (int i = 1; i != n + 1; ++i) {
-        table[i-1] = Q(1.0 / std::pow(2.0, 1.0 / std::pow(2.0, i)));
-    }
-
-    return this_class(table);
+constexpr lut<n, Q> lut<n, Q>::inv_pow2() {
+    return this_class::generate<libq::details::inv_pow2_generator>();
 }
 }  // namespace cordic
 }  // namespace libq
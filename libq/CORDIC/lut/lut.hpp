@@ -14,39 +14,110 @@
 #ifndef INC_LIBQ_CORDIC_LUT_HPP_
 #define INC_LIBQ_CORDIC_LUT_HPP_
 
-#include <array>
+#include <cstddef>
 
 namespace libq {
+namespace details {
+/*!
+ \brief Compile-time sequence of indices (see std::index_sequence in C++14).
+*/
+template<std::size_t... Is>
+struct index_sequence {
+};
+
+template<std::size_t N, std::size_t... Is>
+struct make_index_sequence
+    : public make_index_sequence<N - 1u, N - 1u, Is...> {
+};
+
+template<std::size_t... Is>
+struct make_index_sequence<0u, Is...> {
+    using type = index_sequence<Is...>;
+};
+
+
+/*!
+ \brief Table of the stored integers for fixed-point format Q that is
+ generated at compile time.
+ \tparam Q fixed-point type of the table entries
+ \tparam Generator class providing the static constexpr function
+ value(std::size_t) for the i-th entry
+ \note The table is a constant-initialized static array, so it lives in the
+ read-only data and costs nothing at program start-up.
+*/
+template<typename Q, class Generator, typename Indices>
+class lut_table;
+
+template<typename Q, class Generator, std::size_t... Is>
+class lut_table<Q, Generator, index_sequence<Is...> > {
+ public:
+    enum: std::size_t {
+        dim = (sizeof...(Is) > 0u) ? sizeof...(Is) : 1u
+    };
+
+    static constexpr typename Q::storage_type values[dim] = {
+        libq::details::constexpr_math::to_stored_integer<Q>(
+                                                   Generator::value(Is))...
+    };
+};
+
+template<typename Q, class Generator, std::size_t... Is>
+constexpr typename Q::storage_type
+    lut_table<Q, Generator, index_sequence<Is...> >::values[lut_table<Q, Generator, index_sequence<Is...> >::dim];  // NOLINT
+}  // namespace details
+
+
 namespace cordic {
 
 /*!
  \brief Look-up table for CORDIC algorithms.
  \tparam n
  \tparam Q
+ \note This is a light-weight view to the stored integers computed at compile
+ time. So the factories below are constexpr and do no computations in
+ run-time.
 */
 template<std::size_t n, typename Q>
-class lut
-    : public std::array<Q, n> {
-    using base_class = std::array<Q, n>;
+class lut {
     using this_class = lut<n, Q>;
 
-    explicit lut(base_class const& _dat)
-        : base_class(_dat) {
-    }
-
  public:
     using fixed_point_type = Q;  ///< type of fixed-point numbers
+    using storage_type = typename Q::storage_type;
 
     enum: std::size_t {
         dim = n  ///< size of LUT
     };
 
+    constexpr explicit lut(storage_type const* _values)
+        : m_values(_values) {
+    }
+
+
+    /*!
+     \brief Gets the i-th entry of LUT as a fixed-point number.
+    */
+    Q operator[](std::size_t const _i) const {
+        Q x;
+        libq::lift(x) = this->m_values[_i];
+
+        return x;
+    }
+
+
+    /*!
+     \brief Gets the stored integer behind the i-th entry of LUT.
+    */
+    constexpr storage_type value(std::size_t const _i) const {
+        return this->m_values[_i];
+    }
+
 
     /*!
      \brief Creates the LUT for angles in case of CORDIC rotations are
      performed for circular coordinates.
     */
-    static this_class circular();
+    static constexpr this_class circular();
 
 
     /*!
@@ -54,42 +125,67 @@ class lut
      in hyperbolic coordinates.
      \note This does not use the repeated iterations. All values are unique.
     */
-    static this_class hyperbolic_wo_repeated_iterations();
+    static constexpr this_class hyperbolic_wo_repeated_iterations();
 
 
     /*!
      \brief Creates the LUT of \f$2^{2^{-i}}\f$ for n positions.
      \note This LUT is used for exp function.
     */
-    static this_class pow2();
+    static constexpr this_class pow2();
 
 
     /*!
      \brief Creates the LUT of \f$\frac1{2^\frac1{2^i}}\f$ for n positions.
      \note This LUT is used for log2 function.
     */
-    static this_class inv_pow2();
+    static constexpr this_class inv_pow2();
 
 
     /*!
      \brief Computes the scale of n CORDIC-rotations in circular coordinates.
     */
-    static double circular_scale(std::size_t const _n);
+    static constexpr double circular_scale(std::size_t const _n);
 
 
     /*!
      \brief Creates the LUT for scales of n CORDIC-rotations in case of circular
      coordinates.
     */
-    static this_class circular_scales();
+    static constexpr this_class circular_scales();
 
 
     /*!
-     \brief Computes the scale of n CORDIC-rotations in hyperbolic coordinates.
-     \note This uses repeated iterations for convergence.
+     \brief Computes the scale of CORDIC-rotations in hyperbolic coordinates
+     by shifts 1, 2, ..., n.
+     \note This uses repeated iterations for convergence, i.e. shifts 4, 13,
+     40, ..., 3k + 1 are repeated.
     */
-    static double hyperbolic_scale_with_repeated_iterations(std::size_t _n);
+    static constexpr double
+        hyperbolic_scale_with_repeated_iterations(std::size_t _n);
+
+ private:
+    static constexpr double hyperbolic_scale_from(std::size_t _shift,
+                                                  std::size_t _n,
+                                                  std::size_t _repeated,
+                                                  double _scale);
+
+    template<class Generator>
+    static constexpr this_class generate();
+
+    storage_type const* m_values;
 };
+
+
+template<std::size_t n, typename Q>
+template<class Generator>
+constexpr lut<n, Q> lut<n, Q>::generate() {
+    return this_class(
+        libq::details::lut_table<
+            Q,
+            Generator,
+            typename libq::details::make_index_sequence<n>::type>::values);
+}
 }  // namespace cordic
 }  // namespace libq
 
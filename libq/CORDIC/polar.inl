@@ -0,0 +1,71 @@
+// polar.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file polar.inl
+
+ Provides CORDIC for the polar coordinates of the vector
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_POLAR_INL_
+#define INC_LIBQ_POLAR_INL_
+
+namespace libq {
+/*!
+ \brief Computes both the magnitude and the angle of the vector (x, y). The
+ rotation of CORDIC in vectoring mode yields both at once, so the vector is
+ rotated once instead of twice by std::hypot and std::atan2.
+ \note The results are the ones of std::hypot(x, y) and std::atan2(y, x).
+
+ <B>Usage</B>
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 12>;
+
+    // gets the envelope and the phase of I/Q sample
+    void demodulate(Q const& _i, Q const& _q, Q& _envelope, Q& _phase) {
+        libq::to_polar(_i, _q, _envelope, _phase);
+    }
+ \endcode
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+std::pair<typename libq::details::hypot_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+          typename libq::details::atan2_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    to_polar(libq::fixed_point<T, n, f, e, op, up> _x,
+             libq::fixed_point<T, n, f, e, op, up> _y) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using hypot_type = typename libq::details::hypot_of<Q>::promoted_type;
+    using atan2_type = typename libq::details::atan2_of<Q>::promoted_type;
+
+    libq::details::circular_vectoring<Q> const vectoring(_x, _y);
+
+    return
+        std::make_pair(vectoring.template magnitude<hypot_type>(),
+                       vectoring.template angle<atan2_type>());
+}
+
+
+/*!
+ \brief Computes both the magnitude and the angle of the vector (x, y) as
+ libq::to_polar above, the results are converted to the formats of
+ _magnitude and _angle.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up,
+         typename M, typename A>
+void to_polar(libq::fixed_point<T, n, f, e, op, up> const _x,
+              libq::fixed_point<T, n, f, e, op, up> const _y,
+              M& _magnitude,
+              A& _angle) {
+    auto const result = libq::to_polar(_x, _y);
+
+    _magnitude = M(result.first);
+    _angle = A(result.second);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_POLAR_INL_
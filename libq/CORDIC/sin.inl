@@ -34,77 +34,127 @@ class sin_of<libq::fixed_point<T, n, f, e, op, up> >
                                  , 0
                                  , 0> {
 };
-}  // namespace details
-}  // namespace libq
 
 
-namespace std {
+/*!
+ \brief Gets sin and cos of the angle by one CORDIC rotation in circular
+ coordinates, so std::sin, std::cos and libq::sincos share the reduction of
+ the argument and the iterations.
+ \note The argument is reduced to [-pi, pi] and then to the convergence
+ interval [-pi/2, pi/2] by the shift of pi, which changes the signs of both
+ sin and cos. The rotation of vector (1/K, 0) by the reduced angle yields
+ (cos, sin), see page 10, table 24.1 and pages 4-5, equations (5)-(6).
+*/
+template<typename Q>
+class circular_rotation;
+
 template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
-typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
-    sin(libq::fixed_point<T, n, f, e, op, up> _val) {
-    using sin_type =
-        typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type;  // NOLINT
+class circular_rotation<libq::fixed_point<T, n, f, e, op, up> > {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
 
+ public:
     // gap in 3 bits is needed for CONST_PI existence
     using work_type = libq::Q<f + 3u, f, e, op, up>;
 
-    // convergence interval for CORDIC rotations is [-pi/2, pi/2].
-    // So anyone must map the input angle to that interval
-    work_type arg(0);
-    int sign(1);
-    {
-        // reduce the argument to interval [-pi, +pi] and preserve its sign
-        work_type const x = work_type::CONST_PI -
-            std::fmod(_val, work_type::CONST_2PI);
-        if (x < -work_type::CONST_PI_2) {
-            arg = x + work_type::CONST_PI;
-
-            sign = -1;
-        } else if (x > work_type::CONST_PI_2) {
-            arg = x - work_type::CONST_PI;
-
-            sign = -1;
-        } else {
-            arg = x;
+    explicit circular_rotation(Q const& _val)
+        : m_sign(1),
+          m_cos(0.0),
+          m_sin(0.0) {
+        // convergence interval for CORDIC rotations is [-pi/2, pi/2].
+        // So anyone must map the input angle to that interval
+        work_type arg(0);
+        {
+            // reduce the argument to interval [-pi, +pi]: sin keeps its sign
+            // and cos changes it
+            work_type const x = work_type::CONST_PI -
+                std::fmod(_val, work_type::CONST_2PI);
+            if (x < -work_type::CONST_PI_2) {
+                arg = x + work_type::CONST_PI;
+
+                this->m_sign = -1;
+            } else if (x > work_type::CONST_PI_2) {
+                arg = x - work_type::CONST_PI;
+
+                this->m_sign = -1;
+            } else {
+                arg = x;
+            }
         }
-    }
 
-    using lut_type = libq::cordic::lut<f, work_type>;
-    static auto const angles = lut_type::circular();
+        using lut_type = libq::cordic::lut<f, work_type>;
+        constexpr lut_type angles = lut_type::circular();
 
-    // normalization factor: see page 10, table 24.1 and pages 4-5, equations
-    // (5)-(6)
-    // factor converges to the limit 1.64676 very fast: it takes just 8
-    // iterations.
-    // 8 iterations corresponds to precision of size 0.007812 for the angle
-    // approximation
-    static work_type norm_factor(1.0 / lut_type::circular_scale(f));
+        // normalization factor converges to the limit 1.64676 very fast: it
+        // takes just 8 iterations. 8 iterations corresponds to precision of
+        // size 0.007812 for the angle approximation
+        static constexpr typename work_type::storage_type norm_factor =
+            libq::details::constexpr_math::to_stored_integer<work_type>(
+                                         1.0 / lut_type::circular_scale(f));
 
-    // rotation mode: see page 6
-    // shift sequence is just 0, 1, ... (circular coordinate system)
-    work_type x(norm_factor), y(0.0), z(arg);
-    work_type x1, y1, z1;
+        // rotation mode: see page 6
+        // shift sequence is just 0, 1, ... (circular coordinate system)
+        work_type x(work_type::wrap(norm_factor)), y(0.0), z(arg);
+        work_type x1, y1, z1;
 
 #ifdef LOOP_UNROLLING
-    auto const iteration_body = [&](std::size_t i) {  // NOLINT
+        auto const iteration_body = [&](std::size_t i) {  // NOLINT
 #else
-    for (std::size_t i = 0; i != f; ++i) {
+        for (std::size_t i = 0; i != f; ++i) {
 #endif
-        int const sign = (z > work_type(0)) ? 1 : -1;
-        work_type const x_scaled = work_type::wrap(sign * (x.value() >> i));
-        work_type const y_scaled = work_type::wrap(sign * (y.value() >> i));
+            int const sign = (z > work_type(0)) ? 1 : -1;
+            work_type const x_scaled = work_type::wrap(sign * work_type::rounding_mode::shift_right(x.value(), i));  // NOLINT
+            work_type const y_scaled = work_type::wrap(sign * work_type::rounding_mode::shift_right(y.value(), i));  // NOLINT
 
-        x1 = work_type(x - y_scaled);
-        y1 = work_type(y + x_scaled);
-        z1 = work_type(z - work_type((sign > 0) ? angles[i] : -angles[i]));
+            x1 = work_type(x - y_scaled);
+            y1 = work_type(y + x_scaled);
+            z1 = work_type(z - work_type((sign > 0) ? angles[i] : -angles[i]));  // NOLINT
 
-        x = x1; y = y1; z = z1;
-    };  // NOLINT
+            x = x1; y = y1; z = z1;
+        };  // NOLINT
 #ifdef LOOP_UNROLLING
-    libq::details::unroll(iteration_body, 0u, libq::details::loop_size<f-1>());
+        libq::details::unroll(iteration_body,
+                              0u,
+                              libq::details::loop_size<f-1>());
 #endif
 
-    return sin_type((sign > 0) ? y : -y);
+        this->m_cos = x;
+        this->m_sin = y;
+    }
+
+    /*!
+     \brief Gets sin of the angle as the number of format R.
+    */
+    template<typename R>
+    R sin() const {
+        return R((this->m_sign > 0) ? this->m_sin : -this->m_sin);
+    }
+
+    /*!
+     \brief Gets cos of the angle as the number of format R.
+    */
+    template<typename R>
+    R cos() const {
+        return R((this->m_sign > 0) ? -this->m_cos : this->m_cos);
+    }
+
+ private:
+    int m_sign;
+    work_type m_cos;
+    work_type m_sin;
+};
+}  // namespace details
+}  // namespace libq
+
+
+namespace std {
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
+    sin(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using sin_type = typename libq::details::sin_of<Q>::promoted_type;
+
+    return
+        libq::details::circular_rotation<Q>(_val).template sin<sin_type>();
 }
 }  // namespace std
 
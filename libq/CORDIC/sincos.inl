@@ -0,0 +1,71 @@
+// sincos.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sincos.inl
+
+ Provides CORDIC for sin and cos functions of the same angle
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_SINCOS_INL_
+#define INC_LIBQ_SINCOS_INL_
+
+namespace libq {
+/*!
+ \brief Computes both sin and cos of the angle. The rotation of CORDIC yields
+ the vector (cos, sin) at once, so the argument is reduced and rotated once
+ instead of twice by std::sin and std::cos.
+ \note The results are the ones of std::sin and std::cos, all of these run
+ details::circular_rotation.
+
+ <B>Usage</B>
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 12>;
+
+    void rotate(Q const& _angle, Q& _x, Q& _y) {
+        auto const phasor = libq::sincos(_angle);
+        Q const x(_x * phasor.second - _y * phasor.first);
+        Q const y(_x * phasor.first + _y * phasor.second);
+        _x = x; _y = y;
+    }
+ \endcode
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+std::pair<typename libq::details::sin_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+          typename libq::details::cos_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    sincos(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using sin_type = typename libq::details::sin_of<Q>::promoted_type;
+    using cos_type = typename libq::details::cos_of<Q>::promoted_type;
+
+    libq::details::circular_rotation<Q> const rotation(_val);
+
+    return
+        std::make_pair(rotation.template sin<sin_type>(),
+                       rotation.template cos<cos_type>());
+}
+
+
+/*!
+ \brief Computes both sin and cos of the angle as libq::sincos above, the
+ results are converted to the formats of _sin and _cos.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up,
+         typename S, typename C>
+void sincos(libq::fixed_point<T, n, f, e, op, up> const _val,
+            S& _sin,
+            C& _cos) {
+    auto const result = libq::sincos(_val);
+
+    _sin = S(result.first);
+    _cos = C(result.second);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_SINCOS_INL_
@@ -6,7 +6,8 @@
 /*!
  \file sinh.inl
 
- Provides CORDIC for sinh function as a sum of exponents
+ Provides CORDIC for sinh function as a half-difference of exponents got by
+ one rotation in hyperbolic coordinates
 
  \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures" and
  J.S. Walther, "A Unified Algorithm for Elementary Functions"
@@ -37,6 +38,214 @@ class sinh_of<libq::fixed_point<T, n, f, e, op, up> > {
                                 op,
                                 up>;
 };
+
+
+/*!
+ \brief Gets \f$e^{|x|}\f$ and \f$e^{-|x|}\f$ by one CORDIC rotation in
+ hyperbolic coordinates, so sinh, cosh and tanh are computed without exp.
+ \note The argument is reduced as \f$|x| = k \ln 2 + r\f$, \f$0 \le r < \ln 2\f$.
+ The rotation of vector (1/K, 0) by angle r yields \f$(\cosh r, \sinh r)\f$, so
+ \f$e^{|x|} = 2^k (\cosh r + \sinh r)\f$ and
+ \f$e^{-|x|} = 2^{-k} (\cosh r - \sinh r)\f$.
+ \note The rotations by shifts 4, 13, 40, ..., 3k + 1 are repeated, so these
+ converge for \f$|r| < 1.118\f$, see page 10, table 24.1, m = -1.
+*/
+template<typename Q>
+class hyperbolic_rotation;
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class hyperbolic_rotation<libq::fixed_point<T, n, f, e, op, up> > {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using word_type = libq::details::largest_signed_word;
+
+    enum: std::size_t {
+        // the residual angle of f + 1 rotations is below 2^-(f + 1), and the
+        // rounding errors of up to 2^5 rotations are dropped by the guard bits
+        guard_bits = (f + 8u <= std::numeric_limits<std::intmax_t>::digits) ? 5u : 0u,  // NOLINT
+        iterations = f + 1u,
+        work_bits = f + guard_bits
+    };
+
+ public:
+    // two bits are needed for the gain of rotations and for e^r < 2
+    using work_type = libq::Q<work_bits + 2u, work_bits, e, op, up>;
+
+    explicit hyperbolic_rotation(Q const& _x)
+        : m_is_negative(std::signbit(_x)),
+          m_power(0u),
+          m_rising(0.0),
+          m_falling(0.0) {
+        using lut_type = libq::cordic::lut<iterations, work_type>;
+        constexpr lut_type angles =
+            lut_type::hyperbolic_wo_repeated_iterations();
+
+        static constexpr typename work_type::storage_type norm_factor =
+            libq::details::constexpr_math::to_stored_integer<work_type>(
+                                         1.0 / lut_type::hyperbolic_scale_with_repeated_iterations(iterations));  // NOLINT
+
+        // |x| * log2(e) = k + t, so r = t * ln(2). Both k and t are the bits
+        // of the product, so no conversion is involved
+        using scaled_type =
+            typename libq::details::mult_of<Q, work_type>::promoted_type;
+        enum: int {
+            scaled_bits = static_cast<int>(scaled_type::bits_for_fractional) +
+                          scaled_type::scaling_factor_exponent
+        };
+        static_assert(scaled_bits >= 0 &&
+                      scaled_bits < std::numeric_limits<typename scaled_type::storage_type>::digits,  // NOLINT
+                      "the integral part of the product is not a shift of it");
+
+        scaled_type const scaled(std::fabs(_x) * work_type::CONST_LOG2E);
+        this->m_power =
+            static_cast<std::size_t>(scaled.value() >> scaled_bits);
+        work_type const arg(
+            work_type(scaled_type::wrap(
+                scaled.value() &
+                    ((typename scaled_type::storage_type(1) << scaled_bits) - 1))) *  // NOLINT
+            work_type::CONST_LN2);
+
+        // rotation mode: see page 6
+        work_type x(work_type::wrap(norm_factor)), y(0.0), z(arg);
+        std::size_t repeated(4u);
+
+#ifdef LOOP_UNROLLING
+        auto const iteration_body = [&](std::size_t i) {  // NOLINT
+#else
+        for (std::size_t i = 0u; i != iterations; ++i) {
+#endif
+            hyperbolic_rotation::rotate(x, y, z, i + 1u, angles[i]);
+
+            // repeat until convergence is reached
+            if (i + 1u == repeated) {
+                hyperbolic_rotation::rotate(x, y, z, i + 1u, angles[i]);
+
+                repeated = 3u * repeated + 1u;
+            }
+        };  // NOLINT
+#ifdef LOOP_UNROLLING
+        libq::details::unroll(iteration_body,
+                              0u,
+                              libq::details::loop_size<iterations-1>());
+#endif
+
+        this->m_rising = work_type(x + y);
+        this->m_falling = work_type(x - y);
+    }
+
+    /*!
+     \brief Gets sinh x as the number of format R. The numbers beyond the
+     range of R are reported as the overflow policy of R says.
+    */
+    template<typename R>
+    R sinh() const {
+        return this->half_sum<R>(this->m_is_negative ? -1 : 1, -1);
+    }
+
+    /*!
+     \brief Gets cosh x as the number of format R. See sinh.
+    */
+    template<typename R>
+    R cosh() const {
+        return this->half_sum<R>(1, 1);
+    }
+
+    /*!
+     \brief Gets tanh x as the number of format R, i.e.
+     \f$(e^r - 2^{-2k} e^{-r}) / (e^r + 2^{-2k} e^{-r})\f$. Both terms are
+     below 3, so the quotient takes a single division. It is rounded to
+     nearest by the guard bits as the half sums are.
+    */
+    template<typename R>
+    R tanh() const {
+        static_assert(R::bits_for_fractional == f &&
+                      R::scaling_factor_exponent == e,
+                      "the result is not of the scale of the rotation");
+        using storage_type = typename work_type::storage_type;
+
+        work_type const falling = work_type::wrap(
+            (this->m_power < std::numeric_limits<word_type>::digits / 2u) ?
+                this->m_falling.value() >> (2u * this->m_power) :
+                storage_type(0));
+        work_type const ratio(work_type(this->m_rising - falling) /
+                              work_type(this->m_rising + falling));
+        storage_type const rounded =
+            (ratio.value() + ((storage_type(1) << guard_bits) >> 1)) >> guard_bits;  // NOLINT
+
+        return R::wrap(this->m_is_negative ? -rounded : rounded);
+    }
+
+ private:
+    /*!
+     \brief Rotates (x, y) towards the residual angle z. The terms are
+     negated by the sign mask of z, so the iterations have no branches
+     mispredicted on the sign. All the numbers are below 4 in magnitude, so
+     the sums do not overflow the storage.
+    */
+    static void rotate(work_type& _x,
+                       work_type& _y,
+                       work_type& _z,
+                       std::size_t const _shifts,
+                       work_type const& _angle) {
+        using storage_type = typename work_type::storage_type;
+
+        storage_type const mask = -static_cast<storage_type>(_z.value() < 0);
+        storage_type const x_scaled = work_type::rounding_mode::shift_right(_x.value(), _shifts);  // NOLINT
+        storage_type const y_scaled = work_type::rounding_mode::shift_right(_y.value(), _shifts);  // NOLINT
+
+        _x = work_type::wrap(_x.value() + ((y_scaled ^ mask) - mask));
+        _y = work_type::wrap(_y.value() + ((x_scaled ^ mask) - mask));
+        _z = work_type::wrap(_z.value() - ((_angle.value() ^ mask) - mask));
+    }
+
+    /*!
+     \brief Gets \f$(2^k e^r \pm 2^{-k} e^{-r}) / 2\f$ of the given sign as the
+     number of format R. R holds the stored integers of the same scale as
+     work_type but the guard bits, so these are shifted by k bits and rounded
+     to nearest once.
+    */
+    template<typename R>
+    R half_sum(int const _sign, int const _falling_sign) const {
+        static_assert(R::bits_for_fractional == f &&
+                      R::scaling_factor_exponent == e,
+                      "the result is not of the scale of the rotation");
+
+        enum: std::size_t {
+            // e^r is below 2^(f + guard_bits + e + 1) as the stored integer
+            rising_bits = static_cast<std::size_t>(static_cast<int>(work_bits) + e + 1),  // NOLINT
+
+            // the greater powers are beyond the range of R or of the word
+            max_power =
+                (static_cast<int>(R::bits_for_integral) - e + 1 <
+                    static_cast<int>(std::numeric_limits<word_type>::digits - rising_bits)) ?  // NOLINT
+                    static_cast<std::size_t>(static_cast<int>(R::bits_for_integral) - e + 1) :  // NOLINT
+                    static_cast<std::size_t>(std::numeric_limits<word_type>::digits - rising_bits)  // NOLINT
+        };
+
+        // the half sum of the greater powers is not computed at all, so its
+        // overflow is raised as is rather than detected by R::wrap
+        if (this->m_power > max_power) {
+            libq::details::raise_event_if<typename R::overflow_policy>(
+                libq::details::checks_events_of<typename R::overflow_policy>(
+                    libq::details::checked_operation::conversion));
+
+            return (_sign > 0) ?
+                R::wrap(R::largest_stored_integer) :
+                R::wrap(R::least_stored_integer);
+        }
+
+        word_type const sum =
+            (libq::details::shift_left(static_cast<word_type>(this->m_rising.value()), this->m_power) +  // NOLINT
+                _falling_sign * (static_cast<word_type>(this->m_falling.value()) >> this->m_power) +  // NOLINT
+                (word_type(1) << guard_bits)) >> (guard_bits + 1u);
+
+        return R::wrap(static_cast<word_type>(_sign * sum));
+    }
+
+    bool m_is_negative;
+    std::size_t m_power;
+    work_type m_rising;
+    work_type m_falling;
+};
 }  // namespace details
 }  // namespace libq
 
@@ -47,11 +256,8 @@ typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promote
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using sinh_type = typename libq::details::sinh_of<Q>::promoted_type;
 
-    auto x = static_cast<sinh_type>(std::exp(_val)) -
-        static_cast<sinh_type>(std::exp(-_val));
-    libq::lift(x) >>= 1u;
-
-    return x;
+    return
+        libq::details::hyperbolic_rotation<Q>(_val).template sinh<sinh_type>();  // NOLINT
 }
 }  // namespace std
 
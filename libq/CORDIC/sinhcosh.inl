@@ -0,0 +1,68 @@
+// sinhcosh.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file sinhcosh.inl
+
+ Provides CORDIC for sinh and cosh functions of the same argument
+ \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
+*/
+
+#ifndef INC_LIBQ_SINHCOSH_INL_
+#define INC_LIBQ_SINHCOSH_INL_
+
+namespace libq {
+/*!
+ \brief Computes both sinh and cosh of the argument. The rotation of CORDIC
+ in hyperbolic coordinates yields the vector (cosh, sinh) at once, so the
+ argument is reduced and rotated once instead of twice by std::sinh and
+ std::cosh.
+ \note The results are the ones of std::sinh and std::cosh.
+
+ <B>Usage</B>
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<20, 16>;
+
+    // gets the point of the hyperbola x^2 - y^2 = 1
+    void hyperbola(Q const& _t, Q& _x, Q& _y) {
+        libq::sinhcosh(_t, _y, _x);
+    }
+ \endcode
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+std::pair<typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type,  // NOLINT
+          typename libq::details::sinh_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type>  // NOLINT
+    sinhcosh(libq::fixed_point<T, n, f, e, op, up> _val) {
+    using Q = libq::fixed_point<T, n, f, e, op, up>;
+    using sinh_type = typename libq::details::sinh_of<Q>::promoted_type;
+
+    libq::details::hyperbolic_rotation<Q> const rotation(_val);
+
+    return
+        std::make_pair(rotation.template sinh<sinh_type>(),
+                       rotation.template cosh<sinh_type>());
+}
+
+
+/*!
+ \brief Computes both sinh and cosh of the argument as libq::sinhcosh above,
+ the results are converted to the formats of _sinh and _cosh.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up,
+         typename S, typename C>
+void sinhcosh(libq::fixed_point<T, n, f, e, op, up> const _val,
+              S& _sinh,
+              C& _cosh) {
+    auto const result = libq::sinhcosh(_val);
+
+    _sinh = S(result.first);
+    _cosh = C(result.second);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_SINHCOSH_INL_
@@ -88,54 +88,54 @@ typename libq::details::sqrt_of<T, n, f, e, op, up>::promoted_type
         power++;
     }
 
-    // CORDIC vectoring mode:
-    lut_type const angles = lut_type::hyperbolic_wo_repeated_iterations();
-    typename libq::UQ<f, f, e, op, up> const norm(
-                       lut_type::hyperbolic_scale_with_repeated_iterations(f));
-    work_type x(work_type(arg) + 0.25), y(work_type(arg) - 0.25), z(arg);
+    // CORDIC vectoring mode: the square root is the magnitude of vector
+    // (arg + 1/4, arg - 1/4), so the angles are not accumulated and no LUT is
+    // needed. The gain of rotations is compensated by the multiplication with
+    // its inverse value precomputed at compile time.
+    using norm_type = libq::UQ<f + 1u, f, 0, op, up>;
+    static constexpr typename norm_type::storage_type inv_norm =
+        libq::details::constexpr_math::to_stored_integer<norm_type>(
+                1.0 / lut_type::hyperbolic_scale_with_repeated_iterations(f));
+    work_type x(work_type(arg) + 0.25), y(work_type(arg) - 0.25);
     {
+        // the rotation by the shift drives y towards zero
+        auto const rotate = [&](std::size_t const _shifts) {
+            int const sign = ((x.value() < 0)? -1 : +1) *
+                ((y.value() < 0)? -1 : +1);
+            typename work_type::storage_type const store(x.value());
+            x = x - work_type::wrap(sign * work_type::rounding_mode::shift_right(y.value(), _shifts));  // NOLINT
+            y = y - work_type::wrap(sign * work_type::rounding_mode::shift_right(store, _shifts));  // NOLINT
+        };
         std::size_t repeated(4u);
-        std::size_t num(0);
 
+        // shifts 1, 2, ..., f, where shifts 4, 13, 40, ..., 3k + 1 are
+        // repeated, see lut::hyperbolic_scale_with_repeated_iterations
 #ifdef LOOP_UNROLLING
         auto const iteration_body = [&](std::size_t i) {  // NOLINT
 #else
-        for (std::size_t i = 1u; i < f + 1u; ++i) {
+        for (std::size_t i = 0u; i != f; ++i) {
 #endif
-            int const sign = ((x.value() < 0)? -1 : +1) *
-                ((y.value() < 0)? -1 : +1);
-            typename work_type::storage_type const store(x.value());
-            x = x - work_type::wrap(sign * (y.value() >> (num + 1u)));
-            y = y - work_type::wrap(sign * (store >> (num + 1u)));
-            z = (sign > 0) ? z + angles[num] : z - angles[num];
+            rotate(i + 1u);
 
             // repeat until convergence is reached
-            if (i == repeated && i != n - 1) {
-                int const sign = ((x.value() < 0)? -1 : +1) *
-                    ((y.value() < 0)? -1 : +1);
-                typename work_type::storage_type const store(x.value());
-                x = x - work_type::wrap(sign * (y.value() >> (num + 1u)));
-                y = y - work_type::wrap(sign * (store >> (num + 1u)));
-                z = (sign > 0) ? z + angles[num] : z - angles[num];
-
-                i += 1u;
-                repeated = 3u * repeated  + 1u;
-            }
+            if (i + 1u == repeated) {
+                rotate(i + 1u);
 
-            num += 1u;
+                repeated = 3u * repeated + 1u;
+            }
         };  // NOLINT
 #ifdef LOOP_UNROLLING
         libq::details::unroll(iteration_body,
                               0u,
-                              libq::details::loop_size<f>());
+                              libq::details::loop_size<f-1>());
 #endif
     }
 
-    reduced_type result(x / norm);
+    reduced_type result(x * norm_type::wrap(inv_norm));
     if (power > 0) {
         libq::lift(result) >>= (power >> 1u);
         if (power & 1u) {
-            result = result / reduced_type::CONST_SQRT2;
+            result = reduced_type(result * reduced_type::CONST_SQRT1_2);
         }
     } else {
         std::size_t const p(-power);
@@ -34,14 +34,20 @@ class tan_of<libq::fixed_point<T, n, f, e, op, up> >
 
 
 namespace std {
+/*!
+ \brief Computes tan as the quotient of sin and cos. Both are got by one
+ rotation of libq::sincos, so the argument is reduced and rotated once and
+ the quotient takes a single division.
+*/
 template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
 typename libq::details::tan_of<libq::fixed_point<T, n, f, e, op, up> >::promoted_type  // NOLINT
     tan(libq::fixed_point<T, n, f, e, op, up> _val) {
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using tan_type = typename libq::details::tan_of<Q>::promoted_type;
 
-    auto const x = std::sin(_val);
-    auto const y = std::cos(_val);
+    auto const phasor = libq::sincos(_val);
+    auto const x = phasor.first;
+    auto const y = phasor.second;
 
     if (!y) {
         throw std::logic_error("[std::tan] argument is equal to 0");
@@ -6,15 +6,14 @@
 /*!
  \file tanh.inl
 
- Provides CORDIC for tanh function as a ratio of sinh and tanh
+ Provides CORDIC for tanh function as a ratio of sinh and cosh got by one
+ rotation in hyperbolic coordinates, see sinh.inl
  \ref see H. Dawid, H. Meyr, "CORDIC Algorithms and Architectures"
 */
 
 #ifndef INC_LIBQ_DETAILS_TANH_INL_
 #define INC_LIBQ_DETAILS_TANH_INL_
 
-#include <algorithm>
-
 namespace libq {
 namespace details {
 /*!
@@ -45,23 +44,8 @@ typename libq::details::tanh_of<libq::fixed_point<T, n, f, e, op, up> >::promote
     using Q = libq::fixed_point<T, n, f, e, op, up>;
     using tanh_type = typename libq::details::tanh_of<Q>::promoted_type;
 
-    auto a = std::sinh(_val);
-    auto b = std::cosh(_val);
-
-    // reduce a and b to [0, 1] interval
-    auto m = std::max(std::fabs(a), std::fabs(b));
-    std::size_t shifts(0);
-    while (m >= 1.0) {
-        libq::lift(m) >>= 1u;
-        shifts++;
-    }
-    libq::lift(a) >>= shifts;
-    libq::lift(b) >>= shifts;
-
-    using work_type = typename libq::Q<f, f, e, op, up>;
-    auto const c = tanh_type(work_type(a) / work_type(b));
-
-    return tanh_type(c);
+    return
+        libq::details::hyperbolic_rotation<Q>(_val).template tanh<tanh_type>();  // NOLINT
 }
 }  // namespace std
 
@@ -12,8 +12,31 @@
 #ifndef INC_LIBQ_ARITHMETICS_SAFETY_HPP_
 #define INC_LIBQ_ARITHMETICS_SAFETY_HPP_
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <stdexcept>
+#include <type_traits>
+
+#include "arithmetics_status.hpp"
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 7)
+/*!
+ \brief The compiler provides __builtin_*_overflow_p intrinsics. Unlike
+ __builtin_*_overflow, these can be used within the constant expressions.
+*/
+#define LIBQ_HAS_BUILTIN_OVERFLOW_P
+#endif
+
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+/*!
+ \brief The compiler provides the 128-bit integers __int128 and unsigned
+ __int128.
+ \note <type_traits> knows them as the integral types in the GNU dialects
+ only (e.g. -std=gnu++11), so these are not used in the strict ones.
+*/
+#define LIBQ_HAS_INT128
+#endif
 
 
 namespace libq {
@@ -31,7 +54,11 @@ class overflow_exception_policy {
         does_throw = true
     };
 
-    static void raise_event(std::string const& _msg = std::string{}) {
+    static void raise_event() {
+        throw std::overflow_error("fixed-point overflow");
+    }
+
+    static void raise_event(std::string const& _msg) {
         throw std::overflow_error(_msg);
     }
 };
@@ -47,7 +74,11 @@ class underflow_exception_policy {
         does_throw = true
     };
 
-    static void raise_event(std::string const& _msg = std::string{}) {
+    static void raise_event() {
+        throw std::underflow_error("fixed-point underflow");
+    }
+
+    static void raise_event(std::string const& _msg) {
         throw std::underflow_error(_msg);
     }
 };
@@ -62,14 +93,253 @@ class ignorance_policy {
         does_throw = false
     };
 
-    static void raise_event(std::string const& _msg = std::string{}) {
+    static void raise_event() {
+    }
+
+    static void raise_event(std::string const&) {
+    }
+};
+
+
+/*!
+ \brief Clamps the overflowed results to the largest/least fixed-point
+ numbers of the result format instead of wrapping them around.
+ \note This is for the overflow events only. Being used as underflow policy,
+ it acts as ignorance_policy since the underflowed numbers are flushed to
+ zero anyway.
+*/
+class saturation_policy {
+    using this_class = saturation_policy;
+
+ public:
+    enum: bool {
+        does_throw = false
+    };
+
+    static void raise_event() {
+    }
+
+    static void raise_event(std::string const&) {
+    }
+};
+
+
+/*!
+ \brief Records the overflow events into the thread-local sticky status
+ instead of throwing. See libq::arithmetics_status.
+*/
+class overflow_flag_policy {
+    using this_class = overflow_flag_policy;
+
+ public:
+    enum: bool {
+        does_throw = false
+    };
+
+    static void raise_event() {
+        details::this_thread_counters().record(arithmetics_event::overflow);
+    }
+
+    static void raise_event(std::string const&) {
+        this_class::raise_event();
+    }
+};
+
+
+/*!
+ \brief Records the underflow events into the thread-local sticky status
+ instead of throwing. See libq::arithmetics_status.
+*/
+class underflow_flag_policy {
+    using this_class = underflow_flag_policy;
+
+ public:
+    enum: bool {
+        does_throw = false
+    };
+
+    static void raise_event() {
+        details::this_thread_counters().record(arithmetics_event::underflow);
+    }
+
+    static void raise_event(std::string const&) {
+        this_class::raise_event();
+    }
+};
+
+namespace details {
+
+/*!
+ \brief Enumerates the kinds of the checked operations.
+*/
+enum class checked_operation: std::size_t {
+    conversion = 0u,
+    assignment,
+    addition,
+    subtraction,
+    multiplication,
+    division,
+    negation,
+    number_of_kinds
+};
+
+}  // namespace details
+
+
+/*!
+ \brief Runs the overflow/underflow checks for 1 in N operations only and
+ reports the detected events through Policy. The operations of each kind are
+ counted by the separate thread-local counter, so the counters of the
+ different operations do not form a single chain of dependent instructions.
+ \note Policy is to report the events, e.g. overflow_exception_policy or
+ overflow_flag_policy. The results are never saturated.
+*/
+template<class Policy, std::size_t N = 64u>
+class sampling_policy {
+    using this_class = sampling_policy<Policy, N>;
+
+    static_assert(N > 0u, "sampling period must be positive");
+
+ public:
+    using reporting_policy = Policy;
+
+    enum: bool {
+        does_throw = Policy::does_throw
+    };
+    enum: std::size_t {
+        sampling_period = N
+    };
+
+    static void raise_event() {
+        Policy::raise_event();
+    }
+
+    static void raise_event(std::string const& _msg) {
+        Policy::raise_event(_msg);
+    }
+
+    /*!
+     \brief Counts the operation and checks if it falls into the sample.
+     \note The counters are zero-initialized, so no guard is involved. The
+     first operation of each kind is sampled.
+    */
+    static bool is_sampled(details::checked_operation const _operation) {
+        static thread_local std::size_t countdowns[
+            static_cast<std::size_t>(details::checked_operation::number_of_kinds)];  // NOLINT
+
+        std::size_t& countdown =
+            countdowns[static_cast<std::size_t>(_operation)];
+        return (countdown == 0u) ? (countdown = N - 1u, true) :
+                                   (--countdown, false);
     }
 };
 
 
 namespace details {
 
+/*!
+ \brief Checks if the policy ignores the events. If so, the checks raising
+ these events are dropped at compile time.
+ \note Specialize this for the custom policies doing nothing on events.
+*/
+template<class Policy>
+class is_ignorance_policy
+    : public std::is_same<Policy, libq::ignorance_policy> {
+};
+
+
+/*!
+ \brief Checks if the policy saturates the overflowed results.
+*/
+template<class Policy>
+class is_saturation_policy
+    : public std::is_same<Policy, libq::saturation_policy> {
+};
+
+
+/*!
+ \brief Checks if the policy runs the checks for some operations only.
+*/
+template<class Policy>
+class is_sampling_policy
+    : public std::false_type {
+};
+
+template<class Policy, std::size_t N>
+class is_sampling_policy<libq::sampling_policy<Policy, N> >
+    : public std::true_type {
+};
+
+
+
+/*!
+ \brief Checks if the current operation is to be checked for the events of
+ the policy. Every operation is checked unless the policy samples them.
+*/
+template<class Policy>
+class event_sampling {
+ public:
+    static constexpr bool is_sampled(checked_operation const) {
+        return true;
+    }
+};
+
+template<class Policy, std::size_t N>
+class event_sampling<libq::sampling_policy<Policy, N> > {
+ public:
+    static bool is_sampled(checked_operation const _operation) {
+        return libq::sampling_policy<Policy, N>::is_sampled(_operation);
+    }
+};
+
+
+/*!
+ \brief Checks if the events of the policy are to be raised by the current
+ operation. This is for the operations implemented outside of
+ libq::fixed_point, see fixed_point::checks_overflow.
+*/
+template<class Policy>
+constexpr bool checks_events_of(checked_operation const _operation) {
+    return !is_ignorance_policy<Policy>::value &&
+           !is_saturation_policy<Policy>::value &&
+           event_sampling<Policy>::is_sampled(_operation);
+}
+
+/*!
+ \brief The widest built-in integers. These hold the stored integers of the
+ formats of up to 127 (128 for the unsigned ones) significant bits and the
+ exact products of the 64-bit stored integers.
+*/
+#if defined(LIBQ_HAS_INT128)
+using largest_signed_word = __int128;
+using largest_unsigned_word = unsigned __int128;
+#else
+using largest_signed_word = std::intmax_t;
+using largest_unsigned_word = std::uintmax_t;
+#endif
+
+
+/*!
+ \brief Gets the narrowest of std::intmax_t and largest_signed_word holding
+ the integers below \f$2^{bits}\f$ in magnitude. The sums and the products of
+ up to 63 bits are computed within std::intmax_t, the wider ones take the
+ widening multiplication (e.g. one imul for the 64-bit operands on x64).
+*/
+template<std::size_t bits>
+class exact_word_of {
+ public:
+    using type = typename std::conditional<
+        (bits <= std::numeric_limits<std::intmax_t>::digits),
+        std::intmax_t,
+        largest_signed_word>::type;
+};
+
 template<typename T> class sum_traits;
+template<typename Q1, typename Q2, bool is_difference> class exact_sum_of;
+template<typename Q1,
+         typename Q2,
+         bool is_exact = exact_sum_of<Q1, Q2, false>::is_expandable>
+class comparison_of;
 template<typename T1, typename T2> class mult_of;
 template<typename T1, typename T2> class div_of;
 
@@ -83,46 +353,170 @@ template<typename T1, typename T2> class div_of;
  \{
 */
 
+/*!
+ \brief Raises the event of the policy if the condition holds.
+ \note The result is meaningless. It allows the check to be sequenced by the
+ comma operator before the checked operation within constexpr functions.
+*/
+template<class Policy>
+constexpr bool raise_event_if(bool const _condition) {
+    return _condition ? (Policy::raise_event(), true) : false;
+}
+
+
+/*!
+ \brief Compares the built-in integers of any signedness by their values.
+ \note Once the signs are known, both integers are converted to the word of
+ that sign, so no implicit conversion turns a negative integer into a large
+ unsigned one. The words are 64-bit unless an operand is wider.
+*/
+template<typename T1, typename T2>
+constexpr bool is_below(T1 const _x, T2 const _y) {
+    using signed_word = typename std::conditional<
+        (sizeof(T1) > sizeof(std::intmax_t) || sizeof(T2) > sizeof(std::intmax_t)),  // NOLINT
+        largest_signed_word,
+        std::intmax_t>::type;
+    using unsigned_word = typename std::make_unsigned<signed_word>::type;
+
+    return
+        (_x < 0) ?
+            (!(_y < 0) ||
+             static_cast<signed_word>(_x) < static_cast<signed_word>(_y)) :
+            (!(_y < 0) &&
+             static_cast<unsigned_word>(_x) < static_cast<unsigned_word>(_y));  // NOLINT
+}
+
+
+/*!
+ \brief Checks if the built-in integers of any signedness differ in their
+ values, see is_below.
+*/
+template<typename T1, typename T2>
+constexpr bool differs(T1 const _x, T2 const _y) {
+    return is_below(_x, _y) || is_below(_y, _x);
+}
+
+
+/*!
+ \brief Checks if the integer is beyond the range of stored integers of
+ fixed-point format Q.
+*/
+template<typename Q, typename T>
+constexpr bool is_out_of_range_of(T const _x) {
+    return
+        is_below(_x, Q::least_stored_integer) ||
+        is_below(Q::largest_stored_integer, _x);
+}
+
+
+/*!
+ \brief Checks if the addition of built-in integers overflows.
+*/
+template<typename T>
+constexpr bool does_word_add_overflow(T const _a, T const _b) {
+#if defined(LIBQ_HAS_BUILTIN_OVERFLOW_P)
+    return __builtin_add_overflow_p(_a, _b, T(0));
+#else
+    return
+        (_b > 0 && _a > std::numeric_limits<T>::max() - _b) ||
+        (_b < 0 && _a < std::numeric_limits<T>::min() - _b);
+#endif
+}
+
+
+/*!
+ \brief Checks if the subtraction of built-in integers overflows.
+*/
+template<typename T>
+constexpr bool does_word_sub_overflow(T const _a, T const _b) {
+#if defined(LIBQ_HAS_BUILTIN_OVERFLOW_P)
+    return __builtin_sub_overflow_p(_a, _b, T(0));
+#else
+    return
+        (_b > 0 && _a < std::numeric_limits<T>::min() + _b) ||
+        (_b < 0 && _a > std::numeric_limits<T>::max() + _b);
+#endif
+}
+
+
+/*!
+ \brief Checks if the multiplication of built-in integers overflows.
+*/
+template<typename T>
+constexpr bool does_word_mul_overflow(T const _a, T const _b) {
+#if defined(LIBQ_HAS_BUILTIN_OVERFLOW_P)
+    return __builtin_mul_overflow_p(_a, _b, T(0));
+#else
+    return
+        (_a > 0 && _b > 0 && _a > std::numeric_limits<T>::max() / _b) ||
+        (_a > 0 && _b < 0 && _b < std::numeric_limits<T>::min() / _a) ||
+        (_a < 0 && _b > 0 && _a < std::numeric_limits<T>::min() / _b) ||
+        (_a < 0 && _b < 0 && _b < std::numeric_limits<T>::max() / _a);
+#endif
+}
+
+
 /*!
  \brief Checks if the addition operation overflows.
+ \note If std::intmax_t or largest_signed_word holds the exact sum then this
+ is computed and checked against the range of the result. Otherwise, the word
+ overflow is checked first.
 */
 template<typename T, std::size_t n, std::size_t f, int e, typename... Ps>
-bool
+constexpr bool
     does_add_overflow(libq::fixed_point<T, n, f, e, Ps...> const _x,
                       libq::fixed_point<T, n, f, e, Ps...> const _y) {
     using value_type = fixed_point<T, n, f, e, Ps...>;
     using result_type = typename sum_traits<value_type>::promoted_type;
-
-    auto const a = _x.value();
-    auto const b = _y.value();
+    using word_type = typename result_type::storage_type;
+    using exact_word = typename exact_word_of<n + f + 1u>::type;
 
     return
-        (b > 0 && a > result_type::largest_stored_integer - b) ||
-        (b < 0 && a < result_type::least_stored_integer - b);
+        (n + f < std::numeric_limits<largest_signed_word>::digits) ?
+            is_out_of_range_of<result_type>(
+                static_cast<exact_word>(_x.value()) +
+                static_cast<exact_word>(_y.value())) :
+            does_word_add_overflow(static_cast<word_type>(_x.value()),
+                                   static_cast<word_type>(_y.value())) ||
+            is_out_of_range_of<result_type>(
+                static_cast<word_type>(_x.value()) +
+                static_cast<word_type>(_y.value()));
 }
 
 
 /*!
  \brief Checks if the subtraction operation overflows.
+ \note See does_add_overflow.
 */
 template<typename T, std::size_t n, std::size_t f, int e, typename... Ps>
-static bool
+static constexpr bool
     does_sub_overflow(libq::fixed_point<T, n, f, e, Ps...> const _x,
                       libq::fixed_point<T, n, f, e, Ps...> const _y) {
     using value_type = libq::fixed_point<T, n, f, e, Ps...>;
     using result_type = typename sum_traits<value_type>::promoted_type;
-
-    auto const a = _x.value();
-    auto const b = _y.value();
+    using word_type = typename result_type::storage_type;
+    using exact_word = typename exact_word_of<n + f + 1u>::type;
 
     return
-        (b > 0 && a < result_type::least_stored_integer + b) ||
-        (b < 0 && a > result_type::largest_stored_integer + b);
+        (n + f < std::numeric_limits<largest_signed_word>::digits) ?
+            is_out_of_range_of<result_type>(
+                static_cast<exact_word>(_x.value()) -
+                static_cast<exact_word>(_y.value())) :
+            does_word_sub_overflow(static_cast<word_type>(_x.value()),
+                                   static_cast<word_type>(_y.value())) ||
+            is_out_of_range_of<result_type>(
+                static_cast<word_type>(_x.value()) -
+                static_cast<word_type>(_y.value()));
 }
 
 
 /*!
  \brief Checks if the multiplication operation overflows.
+ \note If std::intmax_t or largest_signed_word holds the exact product (it is
+ so for the formats of up to 63 significant bits if the compiler provides
+ __int128) then this takes one widening multiplication and the range check.
+ Otherwise, the word overflow is checked first and then the range of the
+ product being shifted and rounded as operator* does.
  */
 template<typename T1,
         std::size_t n1,
@@ -133,24 +527,172 @@ template<typename T1,
         std::size_t f2,
         int e2,
         typename... Ps>
-bool
+constexpr bool
     does_mul_overflow(libq::fixed_point<T1, n1, f1, e1, Ps...> const _x,
                       libq::fixed_point<T2, n2, f2, e2, Ps...> const _y) {
     using Q1 = libq::fixed_point<T1, n1, f1, e1, Ps...>;
     using Q2 = libq::fixed_point<T2, n2, f2, e2, Ps...>;
 
-    using result_type = typename mult_of<Q1, Q2>::promoted_type;
-    using result_storage_type = typename result_type::storage_type;
+    using promotion_traits = mult_of<Q1, Q2>;
+    using result_type = typename promotion_traits::promoted_type;
+    using word_type = typename promotion_traits::promoted_storage_type;
+    using exact_word = typename exact_word_of<n1 + f1 + n2 + f2 + 1u>::type;  // NOLINT
+
+    return
+        (n1 + f1 + n2 + f2 < std::numeric_limits<largest_signed_word>::digits) ?
+            is_out_of_range_of<result_type>(
+                static_cast<exact_word>(_x.value()) *
+                static_cast<exact_word>(_y.value())) :
+            does_word_mul_overflow(static_cast<word_type>(_x.value()),
+                                   static_cast<word_type>(_y.value())) ||
+            is_out_of_range_of<result_type>(
+                result_type::rounding_mode::shift_right(
+                    static_cast<word_type>(_x.value()) *
+                        static_cast<word_type>(_y.value()),
+                    promotion_traits::is_expandable ? 0u : f2));
+}
+
+
+/*!
+ \brief Clamps the integer to the lower limit of stored integers of
+ fixed-point format Q.
+*/
+template<typename Q, typename T>
+constexpr T saturate_below(T const _x) {
+    return is_below(_x, Q::least_stored_integer) ?
+        static_cast<T>(Q::least_stored_integer) : _x;
+}
+
 
+/*!
+ \brief Clamps the integer to the range of stored integers of fixed-point
+ format Q.
+ \note The limits are applied one after another, so compilers emit the
+ conditional moves for this rather than branches.
+*/
+template<typename Q, typename T>
+constexpr typename Q::storage_type saturate(T const _x) {
+    return
+        static_cast<typename Q::storage_type>(
+            is_below(Q::largest_stored_integer, saturate_below<Q>(_x)) ?
+                static_cast<T>(Q::largest_stored_integer) :
+                saturate_below<Q>(_x));
+}
 
-    result_storage_type const a = static_cast<result_storage_type>(_x.value());
-    result_storage_type const b = static_cast<result_storage_type>(_y.value());
 
+/*!
+ \brief Adds the built-in integers with saturation to the word limits.
+*/
+template<typename T>
+constexpr T saturated_word_add(T const _a, T const _b) {
     return
-        (a > 0 && b > 0 && a > result_type::largest_stored_integer / b) ||
-        (a > 0 && b < 0 && b < result_type::least_stored_integer / a) ||
-        (a < 0 && b > 0 && a < result_type::least_stored_integer / b) ||
-        (a < 0 && b < 0 && b < result_type::largest_stored_integer / a);
+        does_word_add_overflow(_a, _b) ?
+            ((_b > 0) ? std::numeric_limits<T>::max() :
+                        std::numeric_limits<T>::min()) :
+            static_cast<T>(_a + _b);
+}
+
+
+/*!
+ \brief Subtracts the built-in integers with saturation to the word limits.
+*/
+template<typename T>
+constexpr T saturated_word_sub(T const _a, T const _b) {
+    return
+        does_word_sub_overflow(_a, _b) ?
+            ((_b > 0) ? std::numeric_limits<T>::min() :
+                        std::numeric_limits<T>::max()) :
+            static_cast<T>(_a - _b);
+}
+
+
+/*!
+ \brief Gets the stored integer of the sum being saturated to the range of
+ the result format.
+ \note See does_add_overflow.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, typename... Ps>
+constexpr typename sum_traits<fixed_point<T, n, f, e, Ps...> >::promoted_type::storage_type  // NOLINT
+    saturated_add(libq::fixed_point<T, n, f, e, Ps...> const _x,
+                  libq::fixed_point<T, n, f, e, Ps...> const _y) {
+    using value_type = fixed_point<T, n, f, e, Ps...>;
+    using result_type = typename sum_traits<value_type>::promoted_type;
+    using word_type = typename result_type::storage_type;
+    using exact_word = typename exact_word_of<n + f + 1u>::type;
+
+    return
+        (n + f < std::numeric_limits<largest_signed_word>::digits) ?
+            saturate<result_type>(static_cast<exact_word>(_x.value()) +
+                                  static_cast<exact_word>(_y.value())) :
+            saturate<result_type>(
+                saturated_word_add(static_cast<word_type>(_x.value()),
+                                   static_cast<word_type>(_y.value())));
+}
+
+
+/*!
+ \brief Gets the stored integer of the difference being saturated to the
+ range of the result format.
+ \note See does_sub_overflow.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, typename... Ps>
+constexpr typename sum_traits<fixed_point<T, n, f, e, Ps...> >::promoted_type::storage_type  // NOLINT
+    saturated_sub(libq::fixed_point<T, n, f, e, Ps...> const _x,
+                  libq::fixed_point<T, n, f, e, Ps...> const _y) {
+    using value_type = fixed_point<T, n, f, e, Ps...>;
+    using result_type = typename sum_traits<value_type>::promoted_type;
+    using word_type = typename result_type::storage_type;
+    using exact_word = typename exact_word_of<n + f + 1u>::type;
+
+    return
+        (n + f < std::numeric_limits<largest_signed_word>::digits) ?
+            saturate<result_type>(static_cast<exact_word>(_x.value()) -
+                                  static_cast<exact_word>(_y.value())) :
+            saturate<result_type>(
+                saturated_word_sub(static_cast<word_type>(_x.value()),
+                                   static_cast<word_type>(_y.value())));
+}
+
+
+/*!
+ \brief Gets the stored integer of the product being saturated to the range
+ of the result format.
+ \note See does_mul_overflow.
+*/
+template<typename T1,
+        std::size_t n1,
+        std::size_t f1,
+        typename T2,
+        int e1,
+        std::size_t n2,
+        std::size_t f2,
+        int e2,
+        typename... Ps>
+constexpr typename mult_of<fixed_point<T1, n1, f1, e1, Ps...>, fixed_point<T2, n2, f2, e2, Ps...> >::promoted_storage_type  // NOLINT
+    saturated_mul(libq::fixed_point<T1, n1, f1, e1, Ps...> const _x,
+                  libq::fixed_point<T2, n2, f2, e2, Ps...> const _y) {
+    using Q1 = libq::fixed_point<T1, n1, f1, e1, Ps...>;
+    using Q2 = libq::fixed_point<T2, n2, f2, e2, Ps...>;
+
+    using promotion_traits = mult_of<Q1, Q2>;
+    using result_type = typename promotion_traits::promoted_type;
+    using word_type = typename promotion_traits::promoted_storage_type;
+    using exact_word = typename exact_word_of<n1 + f1 + n2 + f2 + 1u>::type;  // NOLINT
+
+    return
+        (n1 + f1 + n2 + f2 < std::numeric_limits<largest_signed_word>::digits) ?
+            saturate<result_type>(static_cast<exact_word>(_x.value()) *
+                                  static_cast<exact_word>(_y.value())) :
+        does_word_mul_overflow(static_cast<word_type>(_x.value()),
+                               static_cast<word_type>(_y.value())) ?
+            (((_x.value() < 0) != (_y.value() < 0)) ?
+                saturate<result_type>(result_type::least_stored_integer) :
+                saturate<result_type>(result_type::largest_stored_integer)) :
+            saturate<result_type>(
+                result_type::rounding_mode::shift_right(
+                    static_cast<word_type>(_x.value()) *
+                        static_cast<word_type>(_y.value()),
+                    promotion_traits::is_expandable ? 0u : f2));
 }
 
 
@@ -166,31 +708,30 @@ template<typename T1,
          std::size_t f2,
          int e2,
          typename... Ps>
-bool
+constexpr bool
     does_div_overflow(libq::fixed_point<T1, n1, f1, e1, Ps...> const _x,
                       libq::fixed_point<T2, n2, f2, e2, Ps...> const _y) {
     using Q1 = libq::fixed_point<T1, n1, f1, e1, Ps...>;
     using Q2 = libq::fixed_point<T2, n2, f2, e2, Ps...>;
     using result_type = typename div_of<Q1, Q2>::promoted_type;
 
-
-    auto const a = _x.value();
-    auto const b = _y.value();
-
     return
-        (b == 0) || result_type::is_signed *
-                        (a == result_type::least_stored_integer && b == -1);
+        (_y.value() == 0) ||
+            result_type::is_signed *
+                (_x.value() == result_type::least_stored_integer &&
+                 _y.value() == -1);
 }
 
 
 template<typename T, std::size_t n, std::size_t f, int e, typename... Ps>
-bool
+constexpr bool
     does_unary_neg_overflow(libq::fixed_point<T, n, f, e, Ps...> const _x) {
     using result_type = fixed_point<T, n, f, e, Ps...>;
 
-    auto const a = _x.value();
     return
-        result_type::is_signed && (a == result_type::least_stored_integer);
+        result_type::is_signed ?
+            (_x.value() == result_type::least_stored_integer) :
+            (_x.value() != 0);
 }
 /* \} */  // arithmetics_safety
 
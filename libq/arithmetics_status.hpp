@@ -0,0 +1,273 @@
+// arithmetics_status.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file arithmetics_status.hpp
+
+ Provides the sticky status of the overflow/underflow events recorded by
+ libq::overflow_flag_policy and libq::underflow_flag_policy.
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<30, 20, 0, libq::overflow_flag_policy>;
+
+    void process(std::vector<Q>& _samples) {
+        libq::arithmetics_status::reset_this_thread();
+        for (Q& x : _samples) {
+            x = x * x;
+        }
+        if (libq::arithmetics_status::of_this_thread().overflows()) {
+            // handle the overflowed batch once
+        }
+    }
+ \endcode
+*/
+
+#ifndef INC_LIBQ_ARITHMETICS_STATUS_HPP_
+#define INC_LIBQ_ARITHMETICS_STATUS_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+namespace libq {
+
+/*!
+ \brief Enumerates the kinds of the recorded arithmetics events.
+*/
+enum class arithmetics_event: std::size_t {
+    overflow = 0u,
+    underflow = 1u
+};
+
+
+/*!
+ \brief Keeps the numbers of the overflow/underflow events. The sticky flags
+ are raised if at least one event of the kind has occurred since the last
+ reset.
+*/
+class arithmetics_status {
+    using this_class = arithmetics_status;
+
+ public:
+    enum: unsigned {
+        overflow_flag = 1u << static_cast<std::size_t>(arithmetics_event::overflow),  // NOLINT
+        underflow_flag = 1u << static_cast<std::size_t>(arithmetics_event::underflow)  // NOLINT
+    };
+
+    constexpr arithmetics_status(std::uintmax_t const _overflows = 0u,
+                                 std::uintmax_t const _underflows = 0u)
+        : m_overflows(_overflows),
+          m_underflows(_underflows) {}
+
+    constexpr std::uintmax_t overflows() const {
+        return this->m_overflows;
+    }
+
+    constexpr std::uintmax_t underflows() const {
+        return this->m_underflows;
+    }
+
+    constexpr std::uintmax_t count(arithmetics_event const _event) const {
+        return (_event == arithmetics_event::overflow) ?
+            this->overflows() : this->underflows();
+    }
+
+    /*!
+     \brief Gets the sticky status word, i.e. the bitwise OR of overflow_flag
+     and underflow_flag for the kinds being recorded.
+    */
+    constexpr unsigned flags() const {
+        return (this->overflows() ? overflow_flag : 0u) |
+               (this->underflows() ? underflow_flag : 0u);
+    }
+
+    constexpr explicit operator bool() const {
+        return this->flags() != 0u;
+    }
+
+    this_class& operator +=(this_class const& _x) {
+        this->m_overflows += _x.overflows();
+        this->m_underflows += _x.underflows();
+        return *this;
+    }
+
+    /*!
+     \brief Gets the events recorded by the calling thread.
+    */
+    static this_class of_this_thread();
+
+    /*!
+     \brief Gets the events recorded by all threads including the exited
+     ones.
+    */
+    static this_class of_all_threads();
+
+    /*!
+     \brief Clears the events recorded by the calling thread.
+    */
+    static void reset_this_thread();
+
+    /*!
+     \brief Clears the events recorded by all threads.
+     \note The events being recorded concurrently may survive the reset.
+    */
+    static void reset_all_threads();
+
+ private:
+    std::uintmax_t m_overflows;
+    std::uintmax_t m_underflows;
+};
+
+
+namespace details {
+
+/*!
+ \brief Per-thread event counters. Only the owner thread increments them, so
+ the relaxed load/store pairs compile to the plain increments while the other
+ threads may still read them for the aggregated status.
+*/
+class event_counters {
+    using this_class = event_counters;
+
+ public:
+    enum: std::size_t {
+        number_of_kinds = 2u
+    };
+
+    event_counters();
+    ~event_counters();
+
+    event_counters(this_class const&) = delete;
+    this_class& operator =(this_class const&) = delete;
+
+    void record(arithmetics_event const _event) {
+        std::atomic<std::uintmax_t>& counter =
+            this->m_counts[static_cast<std::size_t>(_event)];
+        counter.store(counter.load(std::memory_order_relaxed) + 1u,
+                      std::memory_order_relaxed);
+    }
+
+    std::uintmax_t count(arithmetics_event const _event) const {
+        return this->m_counts[static_cast<std::size_t>(_event)].load(
+            std::memory_order_relaxed);
+    }
+
+    arithmetics_status status() const {
+        return arithmetics_status(this->count(arithmetics_event::overflow),
+                                  this->count(arithmetics_event::underflow));
+    }
+
+    void reset() {
+        for (std::atomic<std::uintmax_t>& counter : this->m_counts) {
+            counter.store(0u, std::memory_order_relaxed);
+        }
+    }
+
+ private:
+    std::atomic<std::uintmax_t> m_counts[number_of_kinds];
+};
+
+
+/*!
+ \brief Keeps track of the counters of the running threads and accumulates
+ the events of the exited ones.
+*/
+class event_registry {
+    using this_class = event_registry;
+
+ public:
+    static this_class& instance() {
+        static this_class registry;
+        return registry;
+    }
+
+    void attach(event_counters* const _counters) {
+        std::lock_guard<std::mutex> const lock(this->m_mutex);
+        this->m_counters.push_back(_counters);
+    }
+
+    void detach(event_counters* const _counters) {
+        std::lock_guard<std::mutex> const lock(this->m_mutex);
+        this->m_retired += _counters->status();
+        this->m_counters.erase(
+            std::remove(this->m_counters.begin(),
+                        this->m_counters.end(),
+                        _counters),
+            this->m_counters.end());
+    }
+
+    arithmetics_status status() {
+        std::lock_guard<std::mutex> const lock(this->m_mutex);
+        arithmetics_status total = this->m_retired;
+        for (event_counters const* const counters : this->m_counters) {
+            total += counters->status();
+        }
+        return total;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> const lock(this->m_mutex);
+        this->m_retired = arithmetics_status();
+        for (event_counters* const counters : this->m_counters) {
+            counters->reset();
+        }
+    }
+
+ private:
+    event_registry() = default;
+
+    std::mutex m_mutex;
+    std::vector<event_counters*> m_counters;
+    arithmetics_status m_retired;
+};
+
+
+inline event_counters::event_counters() {
+    this->reset();
+    event_registry::instance().attach(this);
+}
+
+inline event_counters::~event_counters() {
+    event_registry::instance().detach(this);
+}
+
+
+/*!
+ \brief Gets the counters of the calling thread.
+ \note The thread-local counters are constructed on the first use only, so
+ the threads never raising the events are not registered at all.
+*/
+inline event_counters& this_thread_counters() {
+    static thread_local event_counters counters;
+    return counters;
+}
+
+}  // namespace details
+
+
+inline arithmetics_status arithmetics_status::of_this_thread() {
+    return details::this_thread_counters().status();
+}
+
+inline arithmetics_status arithmetics_status::of_all_threads() {
+    return details::event_registry::instance().status();
+}
+
+inline void arithmetics_status::reset_this_thread() {
+    details::this_thread_counters().reset();
+}
+
+inline void arithmetics_status::reset_all_threads() {
+    details::event_registry::instance().reset();
+}
+
+}  // namespace libq
+
+#endif  // INC_LIBQ_ARITHMETICS_STATUS_HPP_
@@ -0,0 +1,655 @@
+// arithmetics.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file arithmetics.inl
+
+ Provides the arithmetics operations over the arrays of fixed-point numbers.
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 8, 0, libq::saturation_policy>;
+
+    void mix(std::vector<Q>& _x, std::vector<Q> const& _gains) {
+        libq::batch::mul<Q>(_x, _gains, _x);  // x[i] = Q(x[i] * gains[i])
+        libq::batch::abs<Q>(_x, _x);
+    }
+ \endcode
+*/
+
+#ifndef INC_LIBQ_BATCH_ARITHMETICS_INL_
+#define INC_LIBQ_BATCH_ARITHMETICS_INL_
+
+#include <stdexcept>
+#include <algorithm>
+
+namespace libq {
+namespace batch {
+namespace details {
+
+/*!
+ \brief Checks if the policy reports the events, i.e. the scalar operations
+ run the range checks for it.
+*/
+template<class Policy>
+class is_raising_policy
+    : public std::integral_constant<bool,
+        !libq::details::is_ignorance_policy<Policy>::value &&
+        !libq::details::is_saturation_policy<Policy>::value> {
+};
+
+
+/*!
+ \brief Gets the policy with the reporting replaced by libq::ignorance_policy.
+ The rounding mode is kept, so are the results.
+*/
+template<class Policy>
+class silent_policy_of {
+ public:
+    using type = typename std::conditional<is_raising_policy<Policy>::value,
+                                           libq::ignorance_policy,
+                                           Policy>::type;
+};
+
+template<class Rounding, class Policy>
+class silent_policy_of<libq::rounding_policy<Rounding, Policy> > {
+ public:
+    using type = libq::rounding_policy<
+        Rounding,
+        typename silent_policy_of<Policy>::type>;
+};
+
+
+/*!
+ \brief Gets the format Q with the reporting policies replaced by
+ libq::ignorance_policy. The operations of such format have no branches.
+*/
+template<typename Q>
+class silent_of;
+
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+class silent_of<libq::fixed_point<T, n, f, e, op, up> > {
+ public:
+    using type = libq::fixed_point<T,
+                                   n,
+                                   f,
+                                   e,
+                                   typename silent_policy_of<op>::type,
+                                   typename silent_policy_of<up>::type>;
+};
+
+
+/*!
+ \brief Reinterprets the fixed-point number as one of format Q1 having the
+ same stored integer.
+*/
+template<typename Q1, typename Q2>
+LIBQ_BATCH_INLINE Q1 recast(Q2 const& _x) {
+    Q1 result;
+    libq::lift(result) = _x.value();
+
+    return result;
+}
+
+
+/*!
+ \brief Checks if the conversion of the fixed-point number of format R to
+ format Q raises any event. This follows the converting constructor of Q, the
+ dropped bits are rounded by Rounding.
+*/
+template<typename Q, typename R, class Rounding = typename Q::rounding_mode>
+class conversion_check {
+    using this_class = conversion_check<Q, R, Rounding>;
+    using storage_type = typename Q::storage_type;
+
+    enum: int {
+        shifts = (static_cast<int>(R::bits_for_fractional) + R::scaling_factor_exponent) -  // NOLINT
+                 (static_cast<int>(Q::bits_for_fractional) + Q::scaling_factor_exponent)  // NOLINT
+    };
+    enum: bool {
+        does_raise_overflow =
+            is_raising_policy<typename Q::overflow_policy>::value,
+        does_raise_underflow =
+            is_raising_policy<typename Q::underflow_policy>::value,
+
+        /*!
+         \brief Q(_x) is the copy constructor then.
+        */
+        is_same_format = std::is_same<typename silent_of<Q>::type,
+                                      typename silent_of<R>::type>::value
+    };
+
+ public:
+    static constexpr bool does_raise(R const& _x) {
+        return
+            !this_class::is_same_format &&
+            this_class::does_raise(_x,
+                                   std::integral_constant<bool, (shifts > 0)>());
+    }
+
+ private:
+    static constexpr bool does_raise(R const& _x, std::true_type) {
+        return
+            (this_class::does_raise_overflow &&
+             libq::details::is_out_of_range_of<Q>(
+                Rounding::shift_right(_x.value(), shifts))) ||
+            (this_class::does_raise_underflow &&
+             _x.value() && !static_cast<storage_type>(
+                Rounding::shift_right(_x.value(), shifts)));
+    }
+
+    static constexpr bool does_raise(R const& _x, std::false_type) {
+        return
+            this_class::does_raise_overflow &&
+            (_x.value() !=
+                (libq::details::shift_left(storage_type(_x.value()), -shifts) >> -shifts) ||  // NOLINT
+             libq::details::is_out_of_range_of<Q>(
+                libq::details::shift_left(storage_type(_x.value()), -shifts)));
+    }
+};
+
+
+/*!
+ \brief The operations below provide:
+ - scalar(_x, _y) being the scalar counterpart of the batch operation,
+ - silent(_x, _y) being the same for the silent formats, see silent_of,
+ - does_raise<Q>(_x, _y) checking if scalar(_x, _y) raises any event in case
+   of format Q. The operands are of the silent format.
+ - is_prescreened<Q>::value checking if does_raise is available for Q.
+
+ \{
+*/
+class addition {
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::true_type {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x + _y);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x, Q const& _y) {
+        return Q(_x + _y);
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x, S const& _y) {
+        return
+            (is_raising_policy<typename Q::overflow_policy>::value &&
+             libq::details::does_add_overflow(_x, _y)) ||
+            conversion_check<Q, decltype(_x + _y)>::does_raise(_x + _y);
+    }
+};
+
+
+class subtraction {
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::true_type {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x - _y);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x, Q const& _y) {
+        return Q(_x - _y);
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x, S const& _y) {
+        return
+            (is_raising_policy<typename Q::overflow_policy>::value &&
+             libq::details::does_sub_overflow(_x, _y)) ||
+            conversion_check<Q, decltype(_x - _y)>::does_raise(_x - _y);
+    }
+};
+
+
+class multiplication {
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::true_type {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x * _y);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x, Q const& _y) {
+        return Q(_x * _y);
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x, S const& _y) {
+        return
+            (is_raising_policy<typename Q::overflow_policy>::value &&
+             libq::details::does_mul_overflow(_x, _y)) ||
+            conversion_check<Q, decltype(_x * _y)>::does_raise(_x * _y);
+    }
+};
+
+
+/*!
+ \brief There is no SIMD integer division. If the double holds both the
+ scaled dividend and the quotient exactly, i.e. the format is narrow enough,
+ the truncated quotient of doubles is equal to one of integers. So the silent
+ loops are vectorized over doubles then. The quotients being rounded other
+ than by libq::truncation take the scalar loop.
+ \note The scalar division by zero is undefined for the formats ignoring the
+ overflow events only. The zero divisor is replaced by 1 in this case, and the
+ quotient is saturated as the scalar one is in the other cases.
+*/
+class division {
+    template<typename Q>
+    class traits {
+        using promotion_traits = libq::details::div_of<Q, Q>;
+
+     public:
+        using result_type = typename promotion_traits::promoted_type;
+        using word_type = typename promotion_traits::promoted_storage_type;
+
+        enum: std::size_t {
+            shifts = Q::number_of_significant_bits,
+            dividend_bits = Q::number_of_significant_bits + shifts
+        };
+        enum: bool {
+            is_exact_in_double = promotion_traits::is_expandable &&
+                std::is_same<typename result_type::rounding_mode,
+                             libq::truncation>::value &&
+                dividend_bits < std::numeric_limits<double>::digits &&
+                dividend_bits < std::numeric_limits<word_type>::digits
+        };
+    };
+
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::integral_constant<bool, traits<Q>::is_exact_in_double> {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x / _y);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x, Q const& _y) {
+        return division::silent(
+            _x,
+            _y,
+            std::integral_constant<bool, traits<Q>::is_exact_in_double>());
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x, S const& _y) {
+        return division::does_raise<Q>(_x,
+                                       _y,
+                                       division::wrapped_quotient(_x, _y));
+    }
+
+ private:
+    /*!
+     \brief The quotient is computed before the checks, since the compilers
+     do not speculate the floating-point division being skipped by them.
+    */
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool
+        does_raise(S const& _x,
+                   S const& _y,
+                   typename traits<S>::result_type const& _quotient) {
+        using result_type = typename traits<S>::result_type;
+
+        return
+            (is_raising_policy<typename Q::overflow_policy>::value &&
+             (libq::details::does_div_overflow(_x, _y) ||
+              libq::details::is_out_of_range_of<result_type>(
+                _quotient.value()))) ||
+            conversion_check<Q, result_type>::does_raise(_quotient);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x,
+                                      Q const& _y,
+                                      std::false_type) {
+        return Q(_x / _y);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x,
+                                      Q const& _y,
+                                      std::true_type) {
+        using result_type = typename traits<Q>::result_type;
+        using storage_type = typename result_type::storage_type;
+
+        // the zero divisor pushes the quotient beyond the range towards the
+        // sign of dividend as the scalar code does. The range limits are
+        // integers, so the quotient may be clamped before the truncation.
+        double const beyond = static_cast<double>(
+            std::intmax_t(1) << (traits<Q>::dividend_bits + 1u));
+        double const saturated = std::min(
+            std::max(division::exact_quotient(_x, _y) +
+                        (_y.value() == 0) * ((_x.value() < 0) ? -beyond : beyond),  // NOLINT
+                     static_cast<double>(result_type::least_stored_integer)),
+            static_cast<double>(result_type::largest_stored_integer));
+
+        result_type quotient = division::wrapped_quotient(_x, _y);
+        if (libq::details::is_saturation_policy<typename Q::overflow_policy>::value) {  // NOLINT
+            libq::lift(quotient) = static_cast<storage_type>(saturated);
+        }
+
+        return Q(quotient);
+    }
+
+    /*!
+     \brief Gets the quotient of doubles, it is exact up to the truncation.
+    */
+    template<typename Q>
+    static LIBQ_BATCH_INLINE double exact_quotient(Q const& _x, Q const& _y) {
+        using word_type = typename traits<Q>::word_type;
+
+        return
+            static_cast<double>(
+                libq::details::shift_left(static_cast<word_type>(_x.value()),
+                                          traits<Q>::shifts)) /
+            static_cast<double>(_y.value() | (_y.value() == 0));
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE typename traits<Q>::result_type
+        wrapped_quotient(Q const& _x, Q const& _y) {
+        using result_type = typename traits<Q>::result_type;
+
+        result_type quotient;
+        libq::lift(quotient) =
+            static_cast<typename result_type::storage_type>(
+                static_cast<typename traits<Q>::word_type>(
+                    division::exact_quotient(_x, _y)));
+
+        return quotient;
+    }
+};
+
+
+class negation {
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::true_type {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(Q const& _x) {
+        return -_x;
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x) {
+        return -_x;
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x) {
+        return
+            is_raising_policy<typename Q::overflow_policy>::value &&
+            libq::details::does_unary_neg_overflow(_x);
+    }
+};
+
+
+class absolute_value {
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::true_type {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(Q const& _x) {
+        return std::fabs(_x);
+    }
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q silent(Q const& _x) {
+        return std::fabs(_x);
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x) {
+        return
+            is_raising_policy<typename Q::overflow_policy>::value &&
+            _x.value() < 0 &&
+            libq::details::does_unary_neg_overflow(_x);
+    }
+};
+/*! \} */
+
+
+/*!
+ \brief Applies the operation to the arrays of fixed-point numbers.
+ \note The loops over the silent formats have no branches, so these are
+ vectorized. In case of the reporting policies, every block is computed in
+ the silent format first while the branch-free range checks tell if any event
+ is to be raised. If so, the block is recomputed by the scalar operations,
+ which report the events exactly as the scalar loop does.
+ \note The sampling policies count the operations, so the scalar loop is run.
+ So it is for the stochastic rounding, since its results differ from call to
+ call.
+ \note The operands may be of other format than Q (e.g. of the conversions).
+ These are reinterpreted as ones of their own silent formats.
+*/
+template<class Operation, typename Q>
+class kernel {
+    using this_class = kernel<Operation, Q>;
+    using silent_type = typename silent_of<Q>::type;
+    using storage_type = typename Q::storage_type;
+
+    enum: std::size_t {
+        block_size = 256u
+    };
+
+    enum: int {
+        silent_loop = 0,
+        scalar_loop,
+        prescreened_loop,
+
+        loop = std::is_same<Q, silent_type>::value ? silent_loop :
+               (libq::details::is_sampling_policy<typename Q::overflow_policy>::value ||  // NOLINT
+                libq::details::is_sampling_policy<typename Q::underflow_policy>::value ||  // NOLINT
+                !Q::rounding_mode::is_deterministic ||
+                !Operation::template is_prescreened<silent_type>::value) ?
+                scalar_loop : prescreened_loop
+    };
+
+ public:
+    enum: bool {
+        is_vectorized = (this_class::loop != scalar_loop)
+    };
+
+    template<typename... Args>
+    static LIBQ_BATCH_INLINE void run(Q* const _result,
+                                      std::size_t const _size,
+                                      Args const* const... _args) {
+        this_class::run(std::integral_constant<int, this_class::loop>(),
+                        _result,
+                        _size,
+                        _args...);
+    }
+
+ private:
+    template<typename... Args>
+    static LIBQ_BATCH_INLINE void run(std::integral_constant<int, silent_loop>,  // NOLINT
+                                      Q* const _result,
+                                      std::size_t const _size,
+                                      Args const* const... _args) {
+        for (std::size_t i = 0; i != _size; ++i) {
+            _result[i] = Operation::template silent<Q>(_args[i]...);
+        }
+    }
+
+    template<typename... Args>
+    static LIBQ_BATCH_INLINE void run(std::integral_constant<int, scalar_loop>,  // NOLINT
+                                      Q* const _result,
+                                      std::size_t const _size,
+                                      Args const* const... _args) {
+        for (std::size_t i = 0; i != _size; ++i) {
+            _result[i] = Operation::template scalar<Q>(_args[i]...);
+        }
+    }
+
+    template<typename... Args>
+    static LIBQ_BATCH_INLINE void run(std::integral_constant<int, prescreened_loop>,  // NOLINT
+                                      Q* const _result,
+                                      std::size_t const _size,
+                                      Args const* const... _args) {
+        storage_type block[block_size];
+        for (std::size_t start = 0; start < _size; start += block_size) {
+            std::size_t const count = std::min<std::size_t>(block_size,
+                                                            _size - start);
+
+            unsigned raised = 0u;
+            for (std::size_t i = 0; i != count; ++i) {
+                block[i] = Operation::template silent<silent_type>(
+                    this_class::silenced(_args[start + i])...).value();
+                raised |= static_cast<unsigned>(
+                    Operation::template does_raise<Q>(
+                        this_class::silenced(_args[start + i])...));
+            }
+
+            if (raised) {
+                for (std::size_t i = start; i != start + count; ++i) {
+                    _result[i] = Operation::template scalar<Q>(_args[i]...);
+                }
+            } else {
+                for (std::size_t i = 0; i != count; ++i) {
+                    libq::lift(_result[start + i]) = block[i];
+                }
+            }
+        }
+    }
+
+    template<typename R>
+    static LIBQ_BATCH_INLINE typename silent_of<R>::type silenced(R const& _x) {  // NOLINT
+        return details::recast<typename silent_of<R>::type>(_x);
+    }
+};
+
+
+inline void check_sizes(std::size_t const _size, std::size_t const _other) {
+    if (_size != _other) {
+        throw std::invalid_argument("libq::batch: spans of different sizes");
+    }
+}
+
+}  // namespace details
+
+
+/*!
+ \brief Computes _result[i] = Q(_x[i] + _y[i]).
+ \note The results and the raised events are the same as ones of the scalar
+ loop. The spans may overlap only if they are equal.
+ \throw std::invalid_argument if the spans are of different sizes
+*/
+template<typename Q>
+void add(span<Q const> const _x,
+         span<Q const> const _y,
+         span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+    details::check_sizes(_y.size(), _result.size());
+
+    details::dispatch<details::kernel<details::addition, Q> >(
+        _result.data(), _result.size(), _x.data(), _y.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = Q(_x[i] - _y[i]).
+ \note See add.
+*/
+template<typename Q>
+void sub(span<Q const> const _x,
+         span<Q const> const _y,
+         span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+    details::check_sizes(_y.size(), _result.size());
+
+    details::dispatch<details::kernel<details::subtraction, Q> >(
+        _result.data(), _result.size(), _x.data(), _y.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = Q(_x[i] * _y[i]).
+ \note See add.
+*/
+template<typename Q>
+void mul(span<Q const> const _x,
+         span<Q const> const _y,
+         span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+    details::check_sizes(_y.size(), _result.size());
+
+    details::dispatch<details::kernel<details::multiplication, Q> >(
+        _result.data(), _result.size(), _x.data(), _y.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = Q(_x[i] / _y[i]).
+ \note See add. The division is vectorized for the narrow formats only, see
+ details::division.
+*/
+template<typename Q>
+void div(span<Q const> const _x,
+         span<Q const> const _y,
+         span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+    details::check_sizes(_y.size(), _result.size());
+
+    details::dispatch<details::kernel<details::division, Q> >(
+        _result.data(), _result.size(), _x.data(), _y.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = -_x[i].
+ \note See add.
+*/
+template<typename Q>
+void neg(span<Q const> const _x, span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::kernel<details::negation, Q> >(
+        _result.data(), _result.size(), _x.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = std::fabs(_x[i]).
+ \note See add.
+*/
+template<typename Q>
+void abs(span<Q const> const _x, span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::kernel<details::absolute_value, Q> >(
+        _result.data(), _result.size(), _x.data());
+}
+
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_ARITHMETICS_INL_
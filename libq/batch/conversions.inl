@@ -0,0 +1,271 @@
+// conversions.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file conversions.inl
+
+ Provides the conversions of the arrays of floating-point numbers to the
+ fixed-point ones and back, and the ones between the fixed-point formats.
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 8, 0, libq::saturation_policy>;
+
+    void quantize(std::vector<float> const& _samples, std::vector<Q>& _x) {
+        libq::batch::from_float<Q>(_samples, _x);  // x[i] = Q(samples[i])
+    }
+
+    void plot(std::vector<Q> const& _x, std::vector<float>& _points) {
+        libq::batch::to_float<Q>(_x, _points);  // points[i] = float(x[i])
+    }
+
+    void requantize(std::vector<libq::Q<31, 24> > const& _x,
+                    std::vector<Q>& _result) {
+        libq::batch::convert<Q, libq::Q<31, 24>, libq::round_half_even>(
+            _x, _result);
+    }
+ \endcode
+*/
+
+#ifndef INC_LIBQ_BATCH_CONVERSIONS_INL_
+#define INC_LIBQ_BATCH_CONVERSIONS_INL_
+
+#include <algorithm>
+#include <cstdint>
+
+namespace libq {
+namespace batch {
+namespace details {
+
+/*!
+ \brief Rounds the floating-point numbers of type T to the nearest numbers of
+ format Q as the converting constructor does.
+ \note Within the range of Q the conversion neither raises the events nor
+ saturates whatever the policies are, and the rounded stored integer fits the
+ 32-bit lanes (cvttpd2dq) for the storage of up to 31 bits. So every block is
+ converted in the silent way while the branch-free range checks tell if any
+ number (or NaN) is beyond the range. If so, the block is recomputed by the
+ scalar conversions, so the numbers following the thrown event are left
+ intact as the scalar loop does.
+ \note The sampling policies count the conversions, so the scalar loop is run.
+ So it is for the unsigned 64-bit and the 128-bit storage.
+*/
+template<typename Q, typename T>
+class from_float_kernel {
+    using this_class = from_float_kernel<Q, T>;
+    using storage_type = typename Q::storage_type;
+    using word_type = typename std::conditional<
+        (std::numeric_limits<storage_type>::digits <
+            std::numeric_limits<std::int32_t>::digits),
+        std::int32_t,
+        std::intmax_t>::type;
+
+    enum: std::size_t {
+        block_size = 256u
+    };
+
+ public:
+    enum: bool {
+        is_vectorized =
+            !libq::details::is_sampling_policy<typename Q::overflow_policy>::value &&  // NOLINT
+            !libq::details::is_sampling_policy<typename Q::underflow_policy>::value &&  // NOLINT
+            std::numeric_limits<storage_type>::digits <=
+                std::numeric_limits<std::intmax_t>::digits
+    };
+
+    static LIBQ_BATCH_INLINE void run(Q* const _result,
+                                      std::size_t const _size,
+                                      T const* const _x) {
+        this_class::run(std::integral_constant<bool, is_vectorized>(),
+                        _result,
+                        _size,
+                        _x);
+    }
+
+ private:
+    static LIBQ_BATCH_INLINE void run(std::false_type,
+                                      Q* const _result,
+                                      std::size_t const _size,
+                                      T const* const _x) {
+        for (std::size_t i = 0; i != _size; ++i) {
+            _result[i] = Q(_x[i]);
+        }
+    }
+
+    static LIBQ_BATCH_INLINE void run(std::true_type,
+                                      Q* const _result,
+                                      std::size_t const _size,
+                                      T const* const _x) {
+        double const scale = libq::details::constexpr_math::scale_of<Q>::value;
+        double const above = static_cast<double>(Q::largest_stored_integer) + 0.5;  // NOLINT
+        double const below = static_cast<double>(Q::least_stored_integer) - 0.5;  // NOLINT
+
+        storage_type block[block_size];
+        for (std::size_t start = 0; start < _size; start += block_size) {
+            std::size_t const count = std::min<std::size_t>(block_size,
+                                                            _size - start);
+
+            unsigned beyond = 0u;
+            for (std::size_t i = 0; i != count; ++i) {
+                double const scaled = static_cast<double>(_x[start + i]) * scale;  // NOLINT
+
+                beyond |= static_cast<unsigned>(!(scaled < above)) |
+                          static_cast<unsigned>(!(scaled > below));
+                block[i] = static_cast<storage_type>(
+                    static_cast<word_type>(scaled +
+                        libq::details::constexpr_math::rounding_offset(scaled)));  // NOLINT
+            }
+
+            if (beyond) {
+                for (std::size_t i = start; i != start + count; ++i) {
+                    _result[i] = Q(_x[i]);
+                }
+            } else {
+                for (std::size_t i = 0; i != count; ++i) {
+                    libq::lift(_result[start + i]) = block[i];
+                }
+            }
+        }
+    }
+};
+
+
+
+/*!
+ \brief Converts the numbers of format Q to the floating-point numbers of
+ type T as the conversion operators do, i.e. the stored integers are
+ multiplied by the constant power of two. Such loops have no branches, so
+ these are vectorized unless the storage is of 128 bits.
+*/
+template<typename Q, typename T>
+class to_float_kernel {
+ public:
+    enum: bool {
+        is_vectorized = true
+    };
+
+    static LIBQ_BATCH_INLINE void run(T* const _result,
+                                      std::size_t const _size,
+                                      Q const* const _x) {
+        for (std::size_t i = 0; i != _size; ++i) {
+            _result[i] = static_cast<T>(_x[i]);
+        }
+    }
+};
+
+
+
+/*!
+ \brief Converts the numbers of format R to ones of format Q, the dropped bits
+ are rounded by Rounding. See kernel.
+*/
+template<typename R, class Rounding>
+class conversion {
+ public:
+    template<typename Q>
+    class is_prescreened
+        : public std::integral_constant<bool, Rounding::is_deterministic> {
+    };
+
+    template<typename Q>
+    static LIBQ_BATCH_INLINE Q scalar(R const& _x) {
+        return Q::template convert_from<Rounding>(_x);
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE Q silent(S const& _x) {
+        return Q::template convert_from<Rounding>(_x);
+    }
+
+    template<typename Q, typename S>
+    static LIBQ_BATCH_INLINE bool does_raise(S const& _x) {
+        return conversion_check<Q, S, Rounding>::does_raise(_x);
+    }
+};
+
+}  // namespace details
+
+
+/*!
+ \brief Computes _result[i] = Q(_x[i]), i.e. rounds the floating-point
+ numbers to the nearest numbers of format Q.
+ \note The results and the raised events are the same as ones of the scalar
+ loop.
+ \throw std::invalid_argument if the spans are of different sizes
+*/
+template<typename Q>
+void from_float(span<float const> const _x, span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::from_float_kernel<Q, float> >(
+        _result.data(), _result.size(), _x.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = Q(_x[i]) for the double precision numbers.
+ \note See from_float above.
+*/
+template<typename Q>
+void from_float(span<double const> const _x, span<Q> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::from_float_kernel<Q, double> >(
+        _result.data(), _result.size(), _x.data());
+}
+
+
+
+/*!
+ \brief Computes _result[i] = Qdst(_x[i]), i.e. converts the numbers between
+ the fixed-point formats. The dropped low bits are rounded by Rounding (the
+ rounding mode of Qdst by default), see rounding.hpp and
+ fixed_point::convert_from. The numbers beyond the range of
+ Qdst are saturated or reported as the overflow policy of Qdst says.
+ \note The results and the raised events are the same as ones of the scalar
+ loop. The shifts are known at compile time, so the loops are vectorized.
+ \throw std::invalid_argument if the spans are of different sizes
+*/
+template<typename Qdst,
+         typename Qsrc,
+         class Rounding = typename Qdst::rounding_mode>
+void convert(span<Qsrc const> const _x, span<Qdst> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::kernel<details::conversion<Qsrc, Rounding>, Qdst> >(  // NOLINT
+        _result.data(), _result.size(), _x.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = float(_x[i]).
+ \throw std::invalid_argument if the spans are of different sizes
+*/
+template<typename Q>
+void to_float(span<Q const> const _x, span<float> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::to_float_kernel<Q, float> >(
+        _result.data(), _result.size(), _x.data());
+}
+
+
+/*!
+ \brief Computes _result[i] = double(_x[i]).
+ \throw std::invalid_argument if the spans are of different sizes
+*/
+template<typename Q>
+void to_double(span<Q const> const _x, span<double> const _result) {
+    details::check_sizes(_x.size(), _result.size());
+
+    details::dispatch<details::to_float_kernel<Q, double> >(
+        _result.data(), _result.size(), _x.data());
+}
+
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_CONVERSIONS_INL_
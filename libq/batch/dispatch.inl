@@ -0,0 +1,173 @@
+// dispatch.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file dispatch.inl
+
+ Picks the widest instruction set supported by the CPU for the batch kernels
+ at run time.
+*/
+
+#ifndef INC_LIBQ_BATCH_DISPATCH_INL_
+#define INC_LIBQ_BATCH_DISPATCH_INL_
+
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LIBQ_BATCH_HAS_X86_DISPATCH
+#endif
+
+#if defined(LIBQ_BATCH_HAS_X86_DISPATCH)
+#define LIBQ_BATCH_TARGET(isa) __attribute__((target(isa)))
+#define LIBQ_BATCH_INLINE inline __attribute__((always_inline))
+#if defined(__clang__)
+#define LIBQ_BATCH_TARGET_AVX512 "avx512f,avx512bw,avx512dq,avx512vl"
+#else
+#define LIBQ_BATCH_TARGET_AVX512 "avx512f,avx512bw,avx512dq,avx512vl,prefer-vector-width=512"  // NOLINT
+#endif
+#else
+#define LIBQ_BATCH_INLINE inline
+#endif
+
+namespace libq {
+namespace batch {
+
+/*!
+ \brief Enumerates the instruction sets the batch kernels are compiled for.
+ The wider sets come later.
+*/
+enum class instruction_set: unsigned {
+    generic = 0u,
+    sse4_1,
+    avx2,
+    avx512
+};
+
+
+/*!
+ \brief Gets the widest instruction set supported by the CPU.
+*/
+inline instruction_set supported_instruction_set() {
+#if defined(LIBQ_BATCH_HAS_X86_DISPATCH)
+    static instruction_set const supported = [] {
+        __builtin_cpu_init();
+
+        return
+            (__builtin_cpu_supports("avx512f") &&
+             __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("avx512dq") &&
+             __builtin_cpu_supports("avx512vl")) ? instruction_set::avx512 :
+            __builtin_cpu_supports("avx2") ? instruction_set::avx2 :
+            __builtin_cpu_supports("sse4.1") ? instruction_set::sse4_1 :
+                                               instruction_set::generic;
+    }();
+
+    return supported;
+#else
+    return instruction_set::generic;
+#endif
+}
+
+
+namespace details {
+
+inline std::atomic<unsigned>& active_instruction_set_word() {
+    static std::atomic<unsigned> word(
+        static_cast<unsigned>(libq::batch::supported_instruction_set()));
+
+    return word;
+}
+
+}  // namespace details
+
+
+/*!
+ \brief Gets the instruction set being used by the batch kernels.
+*/
+inline instruction_set active_instruction_set() {
+    return static_cast<instruction_set>(
+        details::active_instruction_set_word().load(std::memory_order_relaxed));
+}
+
+
+/*!
+ \brief Restricts the batch kernels to the given instruction set, e.g. to
+ compare the kernels with each other. The sets not supported by the CPU fall
+ back to the supported one.
+ \return the instruction set being used from now on
+*/
+inline instruction_set use_instruction_set(instruction_set const _set) {
+    instruction_set const used =
+        (static_cast<unsigned>(_set) <
+            static_cast<unsigned>(libq::batch::supported_instruction_set())) ?
+                _set : libq::batch::supported_instruction_set();
+
+    details::active_instruction_set_word().store(static_cast<unsigned>(used),
+                                                 std::memory_order_relaxed);
+    return used;
+}
+
+
+namespace details {
+
+/*!
+ \brief Compiles Kernel::run for the instruction set given by the target
+ attribute. The kernels are inlined into these, so their loops over fixed-point
+ numbers are vectorized for that set.
+*/
+#if defined(LIBQ_BATCH_HAS_X86_DISPATCH)
+template<class Kernel, typename... Args>
+LIBQ_BATCH_TARGET(LIBQ_BATCH_TARGET_AVX512)
+void run_avx512(Args... _args) {
+    Kernel::run(_args...);
+}
+
+template<class Kernel, typename... Args>
+LIBQ_BATCH_TARGET("avx2")
+void run_avx2(Args... _args) {
+    Kernel::run(_args...);
+}
+
+template<class Kernel, typename... Args>
+LIBQ_BATCH_TARGET("sse4.1")
+void run_sse4_1(Args... _args) {
+    Kernel::run(_args...);
+}
+#endif
+
+template<class Kernel, typename... Args>
+void run_generic(Args... _args) {
+    Kernel::run(_args...);
+}
+
+
+/*!
+ \brief Runs the kernel compiled for the active instruction set. The kernels
+ running the scalar loops only are compiled for the generic set.
+*/
+template<class Kernel, typename... Args>
+void dispatch(Args... _args) {
+#if defined(LIBQ_BATCH_HAS_X86_DISPATCH)
+    switch (Kernel::is_vectorized ?
+                libq::batch::active_instruction_set() :
+                instruction_set::generic) {
+    case instruction_set::avx512:
+        return details::run_avx512<Kernel>(_args...);
+    case instruction_set::avx2:
+        return details::run_avx2<Kernel>(_args...);
+    case instruction_set::sse4_1:
+        return details::run_sse4_1<Kernel>(_args...);
+    default:
+        break;
+    }
+#endif
+    details::run_generic<Kernel>(_args...);
+}
+
+}  // namespace details
+}  // namespace batch
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_DISPATCH_INL_
@@ -0,0 +1,302 @@
+// reductions.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file reductions.inl
+
+ Provides the sums and the dot products of the arrays of fixed-point numbers.
+ Unlike std::accumulate and std::inner_product, these sum the stored integers
+ exactly within the accumulator having enough guard bits. So the result is
+ rounded and checked once.
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 8>;
+
+    Q power(std::vector<Q> const& _x) {
+        return Q(libq::sum_of_squares<Q>(_x) / Q(_x.size()));
+    }
+ \endcode
+*/
+
+#ifndef INC_LIBQ_BATCH_REDUCTIONS_INL_
+#define INC_LIBQ_BATCH_REDUCTIONS_INL_
+
+#include <algorithm>
+#include <cstdint>
+
+namespace libq {
+namespace batch {
+namespace details {
+
+/*!
+ \brief The word accumulating the sums of blocks.
+*/
+using wide_word = libq::details::largest_signed_word;
+
+
+/*!
+ \brief Gets the narrowest word summing the blocks of 256 terms at least
+ without overflow. The terms are bounded by \f$2^{term\_bits}\f$.
+*/
+template<std::size_t term_bits>
+class block_of {
+    static_assert(term_bits < std::numeric_limits<wide_word>::digits,
+                  "terms are too wide to be summed");
+
+ public:
+    using word_type = typename std::conditional<
+        (term_bits + 8u < std::numeric_limits<std::int32_t>::digits),
+        std::int32_t,
+        typename std::conditional<
+            (term_bits + 8u < std::numeric_limits<std::intmax_t>::digits),
+            std::intmax_t,
+            wide_word>::type>::type;
+
+    enum: std::size_t {
+        // the sums of blocks are kept below 2^(digits - 1)
+        log2_size = std::numeric_limits<word_type>::digits - 1u - term_bits,
+        size = std::size_t(1u) << ((log2_size < 16u) ? log2_size : 16u)
+    };
+};
+
+
+/*!
+ \brief Sums the stored integers.
+*/
+template<typename Q>
+class sum_kernel {
+    using block = block_of<Q::number_of_significant_bits>;
+    using word_type = typename block::word_type;
+
+ public:
+    enum: bool {
+        is_vectorized = true
+    };
+
+    static LIBQ_BATCH_INLINE void run(wide_word* const _total,
+                                      Q const* const _x,
+                                      std::size_t const _size) {
+        wide_word total = 0;
+        for (std::size_t start = 0; start < _size; start += block::size) {
+            std::size_t const count = std::min<std::size_t>(block::size,
+                                                            _size - start);
+
+            word_type partial = 0;
+            for (std::size_t i = start; i != start + count; ++i) {
+                partial += static_cast<word_type>(_x[i].value());
+            }
+            total = libq::details::saturated_word_add(
+                total, static_cast<wide_word>(partial));
+        }
+
+        *_total = total;
+    }
+};
+
+
+/*!
+ \brief Sums the products of stored integers.
+ \note The products of 16-bit signed integers are not summed within the
+ 32-bit lanes without overflow. So x is split into the signed high and the
+ unsigned low bytes, and the products with each of them are summed in 32-bit
+ lanes (pmaddwd/vpdpwssd). The blocks of 256 terms are exact since
+ \f$256 \cdot 255 \cdot 2^{15} < 2^{31}\f$.
+*/
+template<typename Q>
+class dot_kernel {
+    using block = block_of<2u * Q::number_of_significant_bits>;
+    using word_type = typename block::word_type;
+
+    enum: bool {
+        is_split = std::is_same<typename Q::storage_type, std::int16_t>::value
+    };
+    enum: std::size_t {
+        split_block_size = 256u
+    };
+
+ public:
+    enum: bool {
+        is_vectorized = true
+    };
+
+    static LIBQ_BATCH_INLINE void run(wide_word* const _total,
+                                      Q const* const _x,
+                                      Q const* const _y,
+                                      std::size_t const _size) {
+        dot_kernel<Q>::run(std::integral_constant<bool, is_split>(),
+                           _total,
+                           _x,
+                           _y,
+                           _size);
+    }
+
+ private:
+    static LIBQ_BATCH_INLINE void run(std::false_type,
+                                      wide_word* const _total,
+                                      Q const* const _x,
+                                      Q const* const _y,
+                                      std::size_t const _size) {
+        wide_word total = 0;
+        for (std::size_t start = 0; start < _size; start += block::size) {
+            std::size_t const count = std::min<std::size_t>(block::size,
+                                                            _size - start);
+
+            word_type partial = 0;
+            for (std::size_t i = start; i != start + count; ++i) {
+                partial += static_cast<word_type>(_x[i].value()) *
+                           static_cast<word_type>(_y[i].value());
+            }
+            total = libq::details::saturated_word_add(
+                total, static_cast<wide_word>(partial));
+        }
+
+        *_total = total;
+    }
+
+    static LIBQ_BATCH_INLINE void run(std::true_type,
+                                      wide_word* const _total,
+                                      Q const* const _x,
+                                      Q const* const _y,
+                                      std::size_t const _size) {
+        wide_word total = 0;
+        for (std::size_t start = 0; start < _size; start += split_block_size) {
+            std::size_t const count = std::min<std::size_t>(split_block_size,
+                                                            _size - start);
+
+            std::int32_t high = 0, low = 0;
+            for (std::size_t i = start; i != start + count; ++i) {
+                std::int16_t const x_high =
+                    static_cast<std::int16_t>(_x[i].value() >> 8);
+                std::int16_t const x_low =
+                    static_cast<std::int16_t>(_x[i].value() & 0xFF);
+
+                high += std::int32_t(x_high) * std::int32_t(_y[i].value());
+                low += std::int32_t(x_low) * std::int32_t(_y[i].value());
+            }
+            total = libq::details::saturated_word_add(
+                total, static_cast<wide_word>(std::intmax_t(high) * 256 + low));  // NOLINT
+        }
+
+        *_total = total;
+    }
+};
+
+
+/*!
+ \brief Shifts the sum of stored integers by the difference of the fractional
+ bits, i.e. rounds it by Rounding as the conversions do. The left-shifted sums
+ being beyond the range of the word are clamped.
+ \note The sums are below \f$2^{digits}\f$ in magnitude, so the ones shifted
+ by more bits are rounded as the halved ones shifted by digits bits.
+*/
+template<int shifts, class Rounding>
+wide_word scaled(wide_word const _total, std::true_type) {
+    enum: bool {
+        is_dropped = (shifts >= std::numeric_limits<wide_word>::digits)
+    };
+
+    return
+        is_dropped ?
+            Rounding::shift_right(static_cast<wide_word>(_total >> 1),
+                                  std::numeric_limits<wide_word>::digits) :
+            Rounding::shift_right(_total, is_dropped ? 0 : shifts);
+}
+
+template<int shifts, class Rounding>
+wide_word scaled(wide_word const _total, std::false_type) {
+    enum: bool {
+        is_beyond = (-shifts >= std::numeric_limits<wide_word>::digits - 1)
+    };
+    enum: int {
+        left_shifts = is_beyond ? 0 : -shifts
+    };
+    wide_word const limit = is_beyond ?
+        wide_word(0) : (std::numeric_limits<wide_word>::max() >> left_shifts);
+
+    return
+        (_total > limit) ? std::numeric_limits<wide_word>::max() :
+        (_total < -limit) ? std::numeric_limits<wide_word>::min() :
+            _total * (wide_word(1) << left_shifts);
+}
+
+
+/*!
+ \brief Gets the sum of stored integers having _fractional bits as the
+ number of format R. This is the only place the events of R are raised.
+*/
+template<typename R, int fractional>
+R reduced(wide_word const _total) {
+    enum: int {
+        shifts = fractional -
+            (static_cast<int>(R::bits_for_fractional) + R::scaling_factor_exponent)  // NOLINT
+    };
+
+    wide_word const result =
+        details::scaled<shifts, typename R::rounding_mode>(_total,
+            std::integral_constant<bool, (shifts >= 0)>());
+
+    libq::details::raise_event_if<typename R::underflow_policy>(
+        libq::details::checks_events_of<typename R::underflow_policy>(
+            libq::details::checked_operation::conversion) &&
+        _total != 0 && result == 0);
+
+    // the range of R is checked on the wide sum by the value comparisons, so
+    // no clamping to a narrower word is involved
+    return R::wrap(result);
+}
+
+}  // namespace details
+}  // namespace batch
+
+
+/*!
+ \brief Computes the sum of _x[i] with the result of format R.
+ \note The stored integers are summed exactly, so the result is rounded and
+ checked for the events of R once.
+*/
+template<typename Q, typename R = Q>
+R sum(span<Q const> const _x) {
+    batch::details::wide_word total;
+    batch::details::dispatch<batch::details::sum_kernel<Q> >(
+        &total, _x.data(), _x.size());
+
+    return
+        batch::details::reduced<R,
+            static_cast<int>(Q::bits_for_fractional) + Q::scaling_factor_exponent>(total);  // NOLINT
+}
+
+
+/*!
+ \brief Computes the sum of _x[i] * _y[i] with the result of format R.
+ \note See sum.
+ \throw std::invalid_argument if the spans are of different sizes
+*/
+template<typename Q, typename R = Q>
+R dot(span<Q const> const _x, span<Q const> const _y) {
+    batch::details::check_sizes(_x.size(), _y.size());
+
+    batch::details::wide_word total;
+    batch::details::dispatch<batch::details::dot_kernel<Q> >(
+        &total, _x.data(), _y.data(), _x.size());
+
+    return
+        batch::details::reduced<R,
+            2 * (static_cast<int>(Q::bits_for_fractional) + Q::scaling_factor_exponent)>(total);  // NOLINT
+}
+
+
+/*!
+ \brief Computes the sum of _x[i] * _x[i] with the result of format R.
+ \note See sum.
+*/
+template<typename Q, typename R = Q>
+R sum_of_squares(span<Q const> const _x) {
+    return libq::dot<Q, R>(_x, _x);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_BATCH_REDUCTIONS_INL_
@@ -0,0 +1,82 @@
+// accumulator_of.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file accumulator_of.inl
+
+ Gets the format summing N numbers of the same format without overflow.
+*/
+
+#ifndef INC_LIBQ_DETAILS_ACCUMULATOR_OF_INL_
+#define INC_LIBQ_DETAILS_ACCUMULATOR_OF_INL_
+
+namespace libq {
+namespace details {
+
+/*!
+ \brief Gets the number of guard bits, i.e. \f$\lceil \log_2 N \rceil\f$.
+*/
+constexpr std::size_t guard_bits_for(std::uintmax_t const _n) {
+    return (_n <= 1u) ? 0u : 1u + guard_bits_for(_n / 2u + _n % 2u);
+}
+
+
+/*!
+ \brief The non-fixed-point numbers are summed within their own type.
+*/
+template<typename T, std::uintmax_t N>
+class accumulator_of
+    : public type_promotion_base<T, 0, 0, 0> {
+};
+
+/*!
+ \note The sum of N numbers of format \f$(n, f, e)\f$ is within the range of
+ format \f$(n + \lceil \log_2 N \rceil, f, e)\f$. Like the other promoted
+ formats, it gets the narrowest built-in integer as storage, e.g. Q15.8 is
+ summed within 32-bit integers for N up to \f$2^{16}\f$.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up, std::uintmax_t N>  // NOLINT
+class accumulator_of<libq::fixed_point<T, n, f, e, op, up>, N>
+    : public type_promotion_base<libq::fixed_point<T, n, f, e, op, up>,
+                                 guard_bits_for(N),
+                                 0,
+                                 0> {
+    using base_class = type_promotion_base<libq::fixed_point<T, n, f, e, op, up>,  // NOLINT
+                                           guard_bits_for(N),
+                                           0,
+                                           0>;
+
+    static_assert(base_class::is_expandable,
+                  "no built-in integer holds the sum of N numbers");
+};
+
+}  // namespace details
+
+
+/*!
+ \brief Gets the format summing N numbers of format Q without overflow.
+
+ <B>Usage</B>
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 8>;
+
+    libq::accumulator<Q, 256u> total(std::array<Q, 256u> const& _samples) {
+        libq::accumulator<Q, 256u> result(0);
+        for (Q const& x : _samples) {
+            result += x;  // never overflows
+        }
+
+        return result;
+    }
+ \endcode
+*/
+template<typename Q, std::uintmax_t N>
+using accumulator = typename details::accumulator_of<Q, N>::promoted_type;
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_ACCUMULATOR_OF_INL_
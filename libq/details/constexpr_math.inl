@@ -0,0 +1,202 @@
+// constexpr_math.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file constexpr_math.inl
+
+ Provides the elementary functions evaluated at compile time. These are used
+ to generate the CORDIC look-up tables and the fixed-point constants.
+*/
+
+#ifndef INC_LIBQ_DETAILS_CONSTEXPR_MATH_INL_
+#define INC_LIBQ_DETAILS_CONSTEXPR_MATH_INL_
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace libq {
+namespace details {
+namespace constexpr_math {
+/*!
+ \defgroup constexpr_math Compile-time elementary functions for double
+ precision arguments.
+
+ \note All functions are written in the C++11 constexpr style (single return
+ statement) so they can be evaluated by any conforming compiler.
+
+ \{
+*/
+
+/*!
+ \brief Computes \f$2^p\f$ for the integral power p.
+*/
+constexpr double pow2(int _p) {
+    return (_p == 0) ? 1.0 :
+                       (_p > 0) ? 2.0 * pow2(_p - 1) : 0.5 * pow2(_p + 1);
+}
+
+
+constexpr double square(double _x) {
+    return _x * _x;
+}
+
+
+constexpr double abs(double _x) {
+    return (_x < 0.0) ? -_x : _x;
+}
+
+
+/*!
+ \brief Sums the Taylor series of \f$e^x\f$ starting from the k-th term.
+ \note The tail is summed first to keep the rounding errors small.
+*/
+constexpr double exp_series(double _x, double _term, std::size_t _k) {
+    return (_k == 32u) ? _term :
+                         _term + exp_series(_x, _term * _x / (_k + 1u), _k + 1u);  // NOLINT
+}
+
+
+/*!
+ \brief Computes \f$e^x\f$. The argument is halved until \f$|x| \le 0.5\f$.
+*/
+constexpr double exp(double _x) {
+    return (abs(_x) > 0.5) ? square(exp(0.5 * _x)) : exp_series(_x, 1.0, 0u);
+}
+
+
+/*!
+ \brief Does the Newton-Raphson iterations for the square root.
+*/
+constexpr double sqrt_iteration(double _x, double _guess, std::size_t _k) {
+    return (_k == 0u || _guess == 0.5 * (_guess + _x / _guess)) ?
+        _guess : sqrt_iteration(_x, 0.5 * (_guess + _x / _guess), _k - 1u);
+}
+
+
+/*!
+ \brief Computes \f$\sqrt{x}\f$ for \f$x \ge 0\f$.
+*/
+constexpr double sqrt(double _x) {
+    return (_x <= 0.0) ? 0.0 : sqrt_iteration(_x, (_x > 1.0) ? _x : 1.0, 128u);
+}
+
+
+/*!
+ \brief Sums the series \f$\sum_k s^k\frac{x^{2k+1}}{2k+1}\f$, where
+ \f$s = \pm 1\f$.
+*/
+constexpr double odd_power_series(double _power,
+                                  double _x2,
+                                  double _sign,
+                                  std::size_t _k) {
+    return (_k == 64u) ? 0.0 :
+        _power / (2u * _k + 1u) +
+            _sign * odd_power_series(_power * _x2, _x2, _sign, _k + 1u);
+}
+
+
+/*!
+ \brief Computes \f$\arctan x\f$. The argument is reduced to
+ \f$|x| \le 0.5\f$ by \f$\arctan x = 2 \arctan \frac{x}{1 + \sqrt{1 + x^2}}\f$.
+*/
+constexpr double atan(double _x) {
+    return (abs(_x) > 0.5) ?
+        2.0 * atan(_x / (1.0 + sqrt(1.0 + square(_x)))) :
+        odd_power_series(_x, square(_x), -1.0, 0u);
+}
+
+
+/*!
+ \brief Computes \f$\mathrm{arctanh} x\f$ for \f$|x| \le 0.5\f$.
+*/
+constexpr double atanh(double _x) {
+    return odd_power_series(_x, square(_x), 1.0, 0u);
+}
+
+
+/*!
+ \brief Gets the halfway offset, i.e. x + offset(x) truncated towards zero is
+ x rounded to nearest with the halfway cases away from zero.
+ \note The sign is copied by the bitwise operations, so the rounding has no
+ branches.
+*/
+constexpr double rounding_offset(double _x) {
+#if defined(__GNUC__)
+    return __builtin_copysign(0.5, _x);
+#else
+    return (_x > 0.0) ? 0.5 : -0.5;
+#endif
+}
+
+
+/*!
+ \brief Rounds the floating-point number to the nearest integer (halfway
+ cases are rounded away from zero).
+ \note The integers of up to 63 magnitude bits are converted through the
+ signed std::intmax_t (cvttsd2si), which holds every number of their range.
+ The 64-bit unsigned integers take the unsigned conversion for the positive
+ numbers, the 128-bit integers are converted through the 128-bit words.
+*/
+template<typename T>
+constexpr T round_to_nearest(double _x) {
+    using signed_word = typename std::conditional<
+        (sizeof(T) > sizeof(std::intmax_t)),
+        largest_signed_word,
+        std::intmax_t>::type;
+    using unsigned_word = typename std::make_unsigned<signed_word>::type;
+
+    return
+        (std::numeric_limits<T>::digits <=
+            std::numeric_limits<std::intmax_t>::digits) ?
+            static_cast<T>(
+                static_cast<std::intmax_t>(_x + rounding_offset(_x))) :
+        (_x > 0.0) ?
+            static_cast<T>(static_cast<unsigned_word>(_x + 0.5)) :
+            static_cast<T>(static_cast<signed_word>(_x - 0.5));
+}
+
+
+/*!
+ \brief Gets the scale \f$2^{f + e}\f$ of the stored integers of fixed-point
+ format Q and its inverse as the constants, so these are never recomputed at
+ run time (e.g. in the unoptimized builds).
+ \note The number is pre-scaled by \f$2^e\f$, so its stored integer has
+ \f$f + e\f$ fractional bits as the conversions between the formats assume.
+*/
+template<typename Q>
+class scale_of {
+ public:
+    static constexpr double value =
+        pow2(static_cast<int>(Q::bits_for_fractional) +
+             Q::scaling_factor_exponent);
+    static constexpr double inverse =
+        pow2(-static_cast<int>(Q::bits_for_fractional) -
+             Q::scaling_factor_exponent);
+};
+
+template<typename Q>
+constexpr double scale_of<Q>::value;
+
+template<typename Q>
+constexpr double scale_of<Q>::inverse;
+
+
+/*!
+ \brief Gets the stored integer of fixed-point format Q that approximates the
+ floating-point number with rounding to nearest.
+*/
+template<typename Q>
+constexpr typename Q::storage_type to_stored_integer(double _x) {
+    return round_to_nearest<typename Q::storage_type>(
+        _x * scale_of<Q>::value);
+}
+/*! \} */  // constexpr_math
+}  // namespace constexpr_math
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_CONSTEXPR_MATH_INL_
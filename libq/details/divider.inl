@@ -0,0 +1,209 @@
+// divider.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file divider.inl
+
+ Provides the division of many fixed-point numbers by the same divisor. The
+ divisor is turned into the multiply-shift reciprocal once (see T. Granlund
+ and P. L. Montgomery, Division by invariant integers using multiplication),
+ so every quotient takes one widening multiplication instead of the hardware
+ division.
+*/
+
+#ifndef INC_LIBQ_DETAILS_DIVIDER_INL_
+#define INC_LIBQ_DETAILS_DIVIDER_INL_
+
+namespace libq {
+namespace details {
+
+/*!
+ \brief Gets the properties of the multiply-shift reciprocal of the divisor
+ of format Q.
+ \note operator/ truncates the quotient of the dividend shifted by
+ \f$N = n + f\f$ bits to the left. The magnitude of the shifted dividend is
+ below \f$2^{D + N}\f$, where D = n + f + 1 for the signed formats (|least| is
+ \f$2^{n + f}\f$) and D = n + f for the unsigned ones. Let
+ \f$l = \lceil \log_2 |y| \rceil\f$ and
+ \f$m = \lfloor 2^{D + N + l} / |y| \rfloor + 1\f$. Then
+ \f$2^{D + N + l} < m \cdot |y| \le 2^{D + N + l} + 2^l\f$, so
+ \f$\lfloor |x| \cdot 2^N / |y| \rfloor = \lfloor |x| \cdot m / 2^{D + l}
+ \rfloor\f$ for every dividend x. The multiplier m is below
+ \f$2^{D + N + 2}\f$.
+ \note The multiplier takes the sign of y. Since \f$|x| \cdot m / 2^{D + l}\f$
+ is never an integer for \f$x \neq 0\f$, the negative product shifted to the
+ right is one below the quotient truncated towards zero.
+*/
+template<typename Q>
+class reciprocal_of {
+ public:
+    enum: std::size_t {
+        dividend_bits = Q::number_of_significant_bits +
+                        static_cast<std::size_t>(Q::is_signed),
+        shifted_bits = dividend_bits + Q::number_of_significant_bits,
+        multiplier_bits = shifted_bits + 2u,
+        product_bits = dividend_bits + multiplier_bits
+    };
+
+    enum: bool {
+        is_available =
+            div_of<Q, Q>::is_expandable &&
+            std::is_same<typename div_of<Q, Q>::promoted_type::rounding_mode,
+                         libq::truncation>::value &&
+            product_bits <= std::numeric_limits<largest_signed_word>::digits &&  // NOLINT
+            shifted_bits + Q::number_of_significant_bits <
+                std::numeric_limits<largest_unsigned_word>::digits
+    };
+
+    // the product shifted by D bits is of the multiplier bits, so the shifts
+    // by l bits are of the narrower word
+    using multiplier_type = typename exact_word_of<multiplier_bits>::type;
+    using product_type = typename exact_word_of<product_bits>::type;
+
+    /*!
+     \brief Gets the magnitude of the stored integer.
+    */
+    static constexpr std::uintmax_t
+        magnitude(typename Q::storage_type const _x) {
+        return
+            (_x < 0) ? std::uintmax_t(0u) - static_cast<std::uintmax_t>(_x) :
+                       static_cast<std::uintmax_t>(_x);
+    }
+
+    /*!
+     \brief Gets the multiplier of the divisor (zero for the zero divisor).
+    */
+    static constexpr multiplier_type
+        multiplier(typename Q::storage_type const _y) {
+        return
+            (_y < 0) ?
+                -reciprocal_of::multiplier_of(reciprocal_of::magnitude(_y)) :
+                reciprocal_of::multiplier_of(reciprocal_of::magnitude(_y));
+    }
+
+    /*!
+     \brief Gets the shifts l of the product being shifted by D bits.
+    */
+    static constexpr std::size_t shifts(typename Q::storage_type const _y) {
+        return guard_bits_for(reciprocal_of::magnitude(_y));
+    }
+
+ private:
+    static constexpr multiplier_type multiplier_of(std::uintmax_t const _y) {
+        return
+            (_y == 0u) ? multiplier_type(0) :
+                static_cast<multiplier_type>(
+                    (largest_unsigned_word(1u) << (reciprocal_of::is_available ? (shifted_bits + guard_bits_for(_y)) : 0u)) /  // NOLINT
+                        _y + 1u);
+    }
+};
+
+}  // namespace details
+
+
+/*!
+ \brief Divides the numbers of format Q by the same divisor. The results are
+ the ones of operator/ (i.e. of the same format, the same stored integers and
+ the same events), but no hardware division is involved.
+ \note If the product of the dividend and the multiplier does not fit 128 bits
+ (64 bits without __int128) then this runs operator/. So is the division by
+ zero and the quotients being rounded other than by libq::truncation.
+
+ <B>Usage</B>
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 8>;
+
+    void normalize(std::vector<Q>& _x, Q const& _norm) {
+        libq::divider<Q> const divider(_norm);
+        for (Q& x : _x) {
+            x = Q(x / divider);
+        }
+    }
+ \endcode
+*/
+template<typename Q>
+class divider {
+    using this_class = divider<Q>;
+    using traits = details::reciprocal_of<Q>;
+    using multiplier_type = typename traits::multiplier_type;
+
+ public:
+    using result_type = typename details::div_of<Q, Q>::promoted_type;
+
+    explicit divider(Q const& _divisor)
+        : m_divisor(_divisor),
+          m_multiplier(traits::multiplier(_divisor.value())),
+          m_shifts(traits::shifts(_divisor.value())) {
+    }
+
+    Q const& divisor() const {
+        return this->m_divisor;
+    }
+
+    /*!
+     \brief Computes the quotient as _x / divisor() does.
+    */
+    result_type divide(Q const& _x) const {
+        return
+            this->divide(_x,
+                std::integral_constant<bool, traits::is_available>());
+    }
+
+ private:
+    result_type divide(Q const& _x, std::true_type) const {
+        using word_type = typename traits::product_type;
+        using op = typename Q::overflow_policy;
+
+        if (this->m_divisor.value() == 0) {
+            return _x / this->m_divisor;
+        }
+
+        word_type const product =
+            static_cast<word_type>(_x.value()) *
+            static_cast<word_type>(this->m_multiplier);
+        multiplier_type const quotient =
+            (static_cast<multiplier_type>(product >> traits::dividend_bits) >>
+                this->m_shifts) +
+            static_cast<multiplier_type>(product < 0);
+
+        details::raise_event_if<op>(
+            details::checks_events_of<op>(
+                details::checked_operation::division) &&
+            (details::does_div_overflow(_x, this->m_divisor) ||
+             details::is_out_of_range_of<result_type>(quotient)));
+
+        result_type result;
+        libq::lift(result) = details::is_saturation_policy<op>::value ?
+            details::saturate<result_type>(quotient) :
+            static_cast<typename result_type::storage_type>(quotient);
+        return result;
+    }
+
+    result_type divide(Q const& _x, std::false_type) const {
+        return _x / this->m_divisor;
+    }
+
+    Q m_divisor;
+    multiplier_type m_multiplier;
+    std::size_t m_shifts;
+};
+
+
+/*!
+ \brief Divides the fixed-point number by the divisor of the divider. See
+ libq::divider.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+typename divider<libq::fixed_point<T, n, f, e, op, up> >::result_type
+    operator /(libq::fixed_point<T, n, f, e, op, up> const& _x,
+               divider<libq::fixed_point<T, n, f, e, op, up> > const& _y) {
+    return _y.divide(_x);
+}
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_DIVIDER_INL_
@@ -0,0 +1,145 @@
+// exact_sum_of.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file exact_sum_of.inl
+
+ Gets the format holding the sums and the differences of the fixed-point
+ numbers of two different formats exactly.
+*/
+
+#ifndef INC_LIBQ_DETAILS_EXACT_SUM_OF_INL_
+#define INC_LIBQ_DETAILS_EXACT_SUM_OF_INL_
+
+namespace libq {
+namespace details {
+
+/*!
+ \brief Gets the common format of Q1 and Q2 having the finest resolution of
+ them and one more integral bit than the widest range of them. Both operands
+ are aligned by one left shift, so no bit is lost and the sum never overflows.
+ \note The numbers of format (n, f, e) are the multiples of
+ \f$2^{-(f + e)}\f$ below \f$2^{n - e}\f$ in magnitude. The common format
+ takes the scaling exponent of the finer operand, so its fractional bits are
+ never negative.
+ \note The differences are signed even for the unsigned operands.
+ \note The policies are ones of Q1 as the other arithmetics do.
+*/
+template<typename Q1, typename Q2, bool is_difference>
+class exact_sum_of {
+    enum: int {
+        resolution1 = static_cast<int>(Q1::bits_for_fractional) + Q1::scaling_factor_exponent,  // NOLINT
+        resolution2 = static_cast<int>(Q2::bits_for_fractional) + Q2::scaling_factor_exponent,  // NOLINT
+        range1 = static_cast<int>(Q1::bits_for_integral) - Q1::scaling_factor_exponent,  // NOLINT
+        range2 = static_cast<int>(Q2::bits_for_integral) - Q2::scaling_factor_exponent,  // NOLINT
+
+        resolution = (resolution1 < resolution2) ? resolution2 : resolution1,
+        range = ((range1 < range2) ? range2 : range1) + 1,
+        exponent = (resolution1 < resolution2) ?
+            static_cast<int>(Q2::scaling_factor_exponent) :
+            static_cast<int>(Q1::scaling_factor_exponent)
+    };
+
+ public:
+    enum: bool {
+        is_signed = is_difference || Q1::is_signed || Q2::is_signed
+    };
+    enum: std::size_t {
+        bits_for_integral = static_cast<std::size_t>(range + exponent),
+        bits_for_fractional = static_cast<std::size_t>(resolution - exponent),
+        number_of_significant_bits = bits_for_integral + bits_for_fractional,
+
+        shifts1 = static_cast<std::size_t>(resolution - resolution1),
+        shifts2 = static_cast<std::size_t>(resolution - resolution2)
+    };
+    enum: bool {
+        /*!
+         \brief Checks if the formats differ in the numbers they hold. The
+         operands of the same format are added as is.
+        */
+        is_mixed = static_cast<std::size_t>(Q1::bits_for_integral) !=
+                       static_cast<std::size_t>(Q2::bits_for_integral) ||
+                   static_cast<std::size_t>(Q1::bits_for_fractional) !=
+                       static_cast<std::size_t>(Q2::bits_for_fractional) ||
+                   resolution1 != resolution2,
+
+        is_expandable = number_of_significant_bits <= static_cast<std::size_t>(
+            is_signed ? std::numeric_limits<largest_signed_word>::digits :
+                        std::numeric_limits<largest_unsigned_word>::digits)
+    };
+
+ private:
+    // the storage of the formats being too wide is never used
+    enum: std::size_t {
+        storage_bits = is_expandable ? static_cast<std::size_t>(number_of_significant_bits) : 1u
+    };
+
+ public:
+    using storage_type = typename std::conditional<is_signed,
+        typename int_least<storage_bits + 1u>::type,
+        typename uint_least<storage_bits>::type>::type;
+
+    using promoted_type = libq::fixed_point<storage_type,
+                                            bits_for_integral,
+                                            bits_for_fractional,
+                                            exponent,
+                                            typename Q1::overflow_policy,
+                                            typename Q1::underflow_policy>;
+
+    /*!
+     \brief Gets the stored integers of the operands in the common format.
+    */
+    static constexpr storage_type aligned_left(Q1 const& _x) {
+        return details::shift_left(static_cast<storage_type>(_x.value()),
+                                   shifts1);
+    }
+
+    static constexpr storage_type aligned_right(Q2 const& _x) {
+        return details::shift_left(static_cast<storage_type>(_x.value()),
+                                   shifts2);
+    }
+};
+
+
+
+/*!
+ \brief Gets the stored integers of the numbers of formats Q1 and Q2 aligned to
+ the same scale, so these are compared as is. The formats being too wide for
+ the common format of their sum are compared in format Q1.
+*/
+template<typename Q1, typename Q2, bool is_exact>
+class comparison_of {
+    using traits = exact_sum_of<Q1, Q2, false>;
+
+ public:
+    using storage_type = typename traits::storage_type;
+
+    static constexpr storage_type left(Q1 const& _x) {
+        return traits::aligned_left(_x);
+    }
+
+    static constexpr storage_type right(Q2 const& _x) {
+        return traits::aligned_right(_x);
+    }
+};
+
+template<typename Q1, typename Q2>
+class comparison_of<Q1, Q2, false> {
+ public:
+    using storage_type = typename Q1::storage_type;
+
+    static constexpr storage_type left(Q1 const& _x) {
+        return _x.value();
+    }
+
+    static constexpr storage_type right(Q2 const& _x) {
+        return Q1(_x).value();
+    }
+};
+
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_DETAILS_EXACT_SUM_OF_INL_
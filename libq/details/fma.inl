@@ -0,0 +1,186 @@
+// fma.inl
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file fma.inl
+
+ Gets the function std::fma overloaded for fixed-point numbers and the
+ function libq::fma for the operands of different formats.
+*/
+
+#ifndef INC_STD_FMA_INL_
+#define INC_STD_FMA_INL_
+
+namespace libq {
+namespace details {
+
+/*!
+ \brief Gets the properties of the fused multiply-add \f$a \cdot b + c\f$
+ with the result of format Q3.
+ \note The product of stored integers has \f$f_1 + e_1 + f_2 + e_2\f$
+ fractional bits, so it is shifted by the difference with \f$f_3 + e_3\f$ to
+ be added to the stored integer of c. If the exact word (std::intmax_t or
+ largest_signed_word) holds the exact product, its shifted value and the sum
+ then the product is rounded by the rounding mode of Q3 (as the conversion to
+ Q3 does) and the sum is checked once.
+*/
+template<typename Q1, typename Q2, typename Q3>
+class fma_of {
+    using this_class = fma_of<Q1, Q2, Q3>;
+
+    enum: int {
+        shifts = (static_cast<int>(Q1::bits_for_fractional) + Q1::scaling_factor_exponent) +  // NOLINT
+                 (static_cast<int>(Q2::bits_for_fractional) + Q2::scaling_factor_exponent) -  // NOLINT
+                 (static_cast<int>(Q3::bits_for_fractional) + Q3::scaling_factor_exponent)  // NOLINT
+    };
+
+ public:
+    enum: std::size_t {
+        left_shifts = (shifts < 0) ? -shifts : 0,
+        right_shifts = (shifts > 0) ? shifts : 0,
+
+        product_bits = Q1::number_of_significant_bits +
+                       Q2::number_of_significant_bits + left_shifts,
+
+        // the bits of the product, the addend and the carry
+        sum_bits = ((product_bits > Q3::number_of_significant_bits) ?
+                        product_bits : Q3::number_of_significant_bits) + 1u
+    };
+
+    // the least numbers take one bit more
+    using word_type = typename exact_word_of<sum_bits + 1u>::type;
+
+    enum: bool {
+        is_exact = sum_bits < std::numeric_limits<word_type>::digits,
+
+        // the product is shifted out completely
+        is_dropped = right_shifts >= std::numeric_limits<word_type>::digits
+    };
+
+    /*!
+     \brief Gets the product of stored integers scaled to the fractional bits
+     of format Q3 and rounded by its rounding mode.
+     \note The product shifted out completely is below the half of the least
+     bit, so it is reduced to its sign at the quarter of this bit.
+    */
+    static constexpr word_type scaled_product(word_type const _product) {
+        return
+            this_class::is_dropped ?
+                Q3::rounding_mode::shift_right(
+                    static_cast<word_type>((_product > 0) - (_product < 0)), 2u) :  // NOLINT
+                Q3::rounding_mode::shift_right(
+                    libq::details::shift_left(_product, left_shifts),
+                    this_class::is_dropped ?
+                        0u : static_cast<std::size_t>(right_shifts));
+    }
+
+    /*!
+     \brief Checks if some non-zero bits of the product are dropped by
+     scaled_product.
+    */
+    static constexpr bool is_inexact(word_type const _product) {
+        return
+            this_class::is_dropped ? (_product != 0) :
+                (_product & ((word_type(1) << (this_class::is_dropped ? 0u : static_cast<std::size_t>(right_shifts))) - 1)) != 0;  // NOLINT
+    }
+};
+
+
+/*!
+ \brief Computes the fused multiply-add within the exact word.
+*/
+template<typename Q1, typename Q2, typename Q3>
+Q3 fused_multiply_add(Q1 const& _a,
+                      Q2 const& _b,
+                      Q3 const& _c,
+                      std::true_type) {
+    using traits = fma_of<Q1, Q2, Q3>;
+    using up = typename Q3::underflow_policy;
+    using word_type = typename traits::word_type;
+
+    word_type const product =
+        static_cast<word_type>(_a.value()) *
+        static_cast<word_type>(_b.value());
+    word_type const sum =
+        traits::scaled_product(product) +
+        static_cast<word_type>(_c.value());
+
+    raise_event_if<up>(
+        checks_events_of<up>(checked_operation::multiplication) &&
+        sum == 0 && traits::is_inexact(product));
+
+    return Q3::wrap(sum);
+}
+
+
+/*!
+ \brief Computes the fused multiply-add as the sequence of the
+ multiplication and the addition.
+*/
+template<typename Q1, typename Q2, typename Q3>
+Q3 fused_multiply_add(Q1 const& _a,
+                      Q2 const& _b,
+                      Q3 const& _c,
+                      std::false_type) {
+    return Q3(Q3(_a * _b) + _c);
+}
+
+}  // namespace details
+
+
+/*!
+ \brief Computes \f$a \cdot b + c\f$ with the result of format of c. Unlike
+ the expression Q3(a * b + c), the sum is rounded once and raises the
+ overflow event once, i.e. if the result is beyond the range of format Q3.
+ The underflow event is raised if the non-zero result is flushed to zero.
+ \note If no built-in integer holds the exact sum (e.g. for the 64-bit
+ operands without __int128) then this falls back to the multiplication and the
+ addition.
+*/
+template<typename T1,
+         typename T2,
+         typename T3,
+         std::size_t n1,
+         std::size_t n2,
+         std::size_t n3,
+         std::size_t f1,
+         std::size_t f2,
+         std::size_t f3,
+         int e1,
+         int e2,
+         int e3,
+         class op,
+         class up>
+libq::fixed_point<T3, n3, f3, e3, op, up>
+    fma(libq::fixed_point<T1, n1, f1, e1, op, up> const& _a,
+        libq::fixed_point<T2, n2, f2, e2, op, up> const& _b,
+        libq::fixed_point<T3, n3, f3, e3, op, up> const& _c) {
+    using traits = libq::details::fma_of<
+        libq::fixed_point<T1, n1, f1, e1, op, up>,
+        libq::fixed_point<T2, n2, f2, e2, op, up>,
+        libq::fixed_point<T3, n3, f3, e3, op, up> >;
+
+    return
+        libq::details::fused_multiply_add(_a, _b, _c,
+            std::integral_constant<bool, traits::is_exact>());
+}
+}  // namespace libq
+
+namespace std {
+
+/*!
+ \brief function std::fma computes \f$x \cdot y + z\f$ being rounded once.
+ See libq::fma.
+*/
+template<typename T, std::size_t n, std::size_t f, int e, class op, class up>
+libq::fixed_point<T, n, f, e, op, up>
+    fma(libq::fixed_point<T, n, f, e, op, up> const& _x,
+        libq::fixed_point<T, n, f, e, op, up> const& _y,
+        libq::fixed_point<T, n, f, e, op, up> const& _z) {
+    return libq::fma(_x, _y, _z);
+}
+}  // namespace std
+
+#endif  // INC_STD_FMA_INL_
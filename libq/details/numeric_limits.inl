@@ -63,36 +63,36 @@ class numeric_limits<libq::fixed_point<T, n, f, e, op, up> > {
     static int const radix = 2;
 
     /// \brief minimum value that can be achieved by fixed-point type
-    static Q min() throw() {
+    static constexpr Q min() throw() {
         return Q::least();
     }
 
     /// \brief maximum value that can be achieved by fixed-point type
-    static Q max() throw() {
+    static constexpr Q max() throw() {
         return Q::largest();
     }
 
     /// \brief returns the machine epsilon, that is, the difference between
     /// 1.0 and the next value representable by the fixed-point type
-    static Q epsilon() throw() {
+    static constexpr Q epsilon() throw() {
         return Q::wrap(1u);
     }
 
     /// \brief the maximum rounding error for fixed-point type
-    static Q round_error() throw() {
+    static constexpr Q round_error() throw() {
         return Q(0.5f);
     }
 
-    static Q denorm_min() throw() {
+    static constexpr Q denorm_min() throw() {
         return Q::wrap(0);
     }
-    static Q infinity() throw() {
+    static constexpr Q infinity() throw() {
         return Q::wrap(0);
     }
-    static Q quiet_NaN() throw() {
+    static constexpr Q quiet_NaN() throw() {
         return Q(0);
     }
-    static Q signaling_NaN() throw() {
+    static constexpr Q signaling_NaN() throw() {
         return Q(0);
     }
 };
@@ -30,7 +30,7 @@ class sum_traits<libq::fixed_point<T, n, f, e, op, up> >
                                  0> {
  public:
     static double error() {
-        return exp2(-f+e);
+        return exp2(-(static_cast<double>(f) + e));
     }
 };
 }  // namespace details
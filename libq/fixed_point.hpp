@@ -14,16 +14,19 @@
 #define INC_LIBQ_FIXED_POINT_HPP_
 
 #include <boost/integer.hpp>
-#include <boost/integer/integer_mask.hpp>
 
+#include <climits>
 #include <cstdint>
 #include <cmath>
 #include <limits>
 #include <exception>
 #include <type_traits>
+#include <utility>
 
 #include "arithmetics_safety.hpp"
+#include "rounding.hpp"
 #include "type_promotion.hpp"
+#include "details/constexpr_math.inl"
 
 
 #ifndef IMPLICIT_COPY_CTR
@@ -35,13 +38,71 @@
 
 namespace libq {
 namespace details {
-    double exp2(double _val) {
+    inline double exp2(double _val) {
 #if defined(_MSC_VER)
         return std::exp2(_val);
 #elif defined(__GNUC__)
         return std::pow(2.0, _val);
 #endif
     }
+
+
+    /*!
+     \brief Shifts the integer to the left. Unlike the built-in shift, this is
+     well-defined for the negative numbers and so it is allowed within the
+     constant expressions.
+    */
+    template<typename T>
+    constexpr T shift_left(T const _x, std::size_t const _shifts) {
+        using word_type = typename std::conditional<
+            (sizeof(T) > sizeof(std::uintmax_t)),
+            largest_unsigned_word,
+            std::uintmax_t>::type;
+
+        return
+            static_cast<T>(static_cast<word_type>(_x) << _shifts);
+    }
+
+
+    /*!
+     \brief Gets the number of bits of the non-negative integer, i.e. the
+     position of its highest set bit plus one (zero for zero). GCC counts the
+     leading zeros by one instruction (lzcnt/bsr), otherwise the bits are
+     bisected in log2 of the width steps.
+    */
+    template<typename T>
+    std::size_t bit_length(T const _x) {
+#if defined(__GNUC__)
+        using word_type = unsigned long long;  // NOLINT
+
+        enum: std::size_t {
+            word_bits = sizeof(word_type) * CHAR_BIT
+        };
+
+        word_type const low = static_cast<word_type>(_x);
+        word_type const high =
+            (sizeof(T) > sizeof(word_type)) ?
+                static_cast<word_type>(_x >> ((sizeof(T) > sizeof(word_type)) ? static_cast<std::size_t>(word_bits) : 0u)) :  // NOLINT
+                0u;
+        word_type const top = (high != 0u) ? high : low;
+
+        return
+            ((high != 0u) ? static_cast<std::size_t>(word_bits) : 0u) +
+            (word_bits - static_cast<std::size_t>(__builtin_clzll(top | 1u))) -  // NOLINT
+            static_cast<std::size_t>(top == 0u);
+#else
+        T x = _x;
+        std::size_t length = 0u;
+        for (std::size_t step = sizeof(T) * CHAR_BIT / 2u; step != 0u; step /= 2u) {  // NOLINT
+            T const high = static_cast<T>(x >> step);
+
+            length += (high != 0) ? step : 0u;
+            x = (high != 0) ? high : x;
+        }
+
+        return length + static_cast<std::size_t>(x != 0);
+#endif
+    }
 }  // details
 
 /*!
@@ -71,8 +132,10 @@ T const lift(fixed_point<T, n, f, e, Ps...> const& _x) {
  \remark Note, \f$n\f$ and \f$f\f$ exclude the sign bit. So if storage_type is
  signed then total number of bits is \f$(n + f + 1)\f$.
  \remark Note, the supremum of \f$(n + f)\f$ is
- std::numeric_limits<std::uintmax_t>::digits in case of the unsigned numbers
- and std::numeric_limits<std::intmax_t>::digits in case of the signed numbers.
+ std::numeric_limits<details::largest_unsigned_word>::digits in case of the
+ unsigned numbers and std::numeric_limits<details::largest_signed_word>::digits
+ in case of the signed numbers, i.e. 128 and 127 if the compiler provides
+ __int128.
  \tparam e Exponent of the pre-scaling factor \f$2^e\f$.
  \tparam op Policy class specifying the actions to do if overflow occurred.
  \tparam up Policy class specifying the actions to do if underflow occurred.
@@ -118,15 +181,50 @@ class fixed_point {
                   "value_type must be of the built-in integral type");
 
     using this_class = fixed_point<value_type, n, f, e, op, up>;
+
+    // the limits of the 128-bit stored integers only are of the 128-bit type,
+    // so the narrower formats are checked within std::intmax_t as before
+    enum: bool {
+        is_wide = sizeof(value_type) > sizeof(std::uintmax_t)
+    };
+    using largest_unsigned_type = typename std::conditional<
+                                    this_class::is_wide,
+                                    details::largest_unsigned_word,
+                                    std::uintmax_t>::type;
+    using least_type = typename std::conditional<
+                                    this_class::is_wide,
+                                    details::largest_signed_word,
+                                    std::intmax_t>::type;
     using largest_type = typename std::conditional<
                                     std::numeric_limits<value_type>::is_signed,
-                                    std::intmax_t, std::uintmax_t>::type;
+                                    least_type, largest_unsigned_type>::type;
+
+    enum: bool {
+        /*!
+         \brief Checks if the overflowed results are clamped to the range.
+        */
+        does_saturate_overflow = details::is_saturation_policy<op>::value,
+
+        /*!
+         \brief These check if the overflow/underflow events are handled
+         somehow. Otherwise, the range checks are skipped.
+        */
+        does_check_overflow = !details::is_ignorance_policy<op>::value &&
+                              !does_saturate_overflow,
+        does_check_underflow = !details::is_ignorance_policy<up>::value &&
+                               !details::is_saturation_policy<up>::value
+    };
 
  public:
     using type = this_class;
     using overflow_policy = op;
     using underflow_policy = up;
 
+    /*!
+     \brief The rounding mode of the dropped low bits, see rounding_policy.
+    */
+    using rounding_mode = typename details::rounding_of<up>::type;
+
     /*!
      \brief Used type for the stored integer.
     */
@@ -161,19 +259,17 @@ class fixed_point {
     /*!
      \brief Gets the scaling factor for this fixed-point number.
     */
-    inline static double scaling_factor() {
-        static double const factor = details::exp2(
-                    -static_cast<double>(this_class::scaling_factor_exponent));
-
-        return factor;
+    static constexpr double scaling_factor() {
+        return details::constexpr_math::pow2(
+                    -this_class::scaling_factor_exponent);
     }
 
 
     static_assert(this_class::number_of_significant_bits <=
                     std::numeric_limits<largest_type>::digits,
                   "too big word size is required");
-#define EXP2N(N) (std::uintmax_t(1u) << (N))
-    enum : std::uintmax_t {
+#define EXP2N(N) (largest_unsigned_type(1u) << (N))
+    enum : largest_unsigned_type {
         /*!
          \brief Scale factor for this fixed-point number.
         */
@@ -201,11 +297,12 @@ class fixed_point {
      \brief The maximum value of stored integer for this fixed-point format.
     */
     static typename this_class::largest_type const largest_stored_integer =
-        boost::low_bits_mask_t<this_class::number_of_significant_bits>::sig_bits;  // NOLINT
+        (this_class::number_of_significant_bits > 0u) ?
+            2 * ((largest_type(1) << (this_class::number_of_significant_bits > 0u ? this_class::number_of_significant_bits - 1u : 0u)) - 1) + 1 : 0;  // NOLINT
     /*!
      \brief Gets the maximum available fixed-point number.
     */
-    static this_class largest() {
+    static constexpr this_class largest() {
         return
             this_class::wrap<typename this_class::largest_type>(
                                            this_class::largest_stored_integer);
@@ -215,12 +312,12 @@ class fixed_point {
     /*
      \brief The minimum value of stored integer for this fixed-point format.
     */
-    static std::intmax_t const least_stored_integer =
-        this_class::is_signed * (-static_cast<std::intmax_t>(this_class::largest_stored_integer) - 1);  // NOLINT
+    static typename this_class::least_type const least_stored_integer =
+        this_class::is_signed * (-static_cast<least_type>(this_class::largest_stored_integer) - 1);  // NOLINT
     /*!
      \brief Gets the minimum available fixed-point number.
     */
-    static this_class least() {
+    static constexpr this_class least() {
         return
             this_class::wrap(this_class::least_stored_integer);
     }
@@ -241,7 +338,7 @@ class fixed_point {
     /*!
      \brief Gets the precision of this fixed-point number.
     */
-    static double precision() {
+    static constexpr double precision() {
         return
             1.0 / this_class::scale;
     }
@@ -292,30 +389,66 @@ class fixed_point {
      \endcode
     */
     template<typename T>
-    static this_class wrap(T const& _val) {
+    static constexpr this_class wrap(T const& _val) {
         static_assert(std::is_integral<T>::value,
                       "input param must be of the built-in integral type");
 
-        if ((_val < 0 && _val < this_class::least_stored_integer) ||
-            (_val > 0 && _val > this_class::largest_stored_integer)) {
-            overflow_policy::raise_event();
-        }
-
-        this_class x;
-        x.m_value = storage_type(_val);
-
-        return x;
+        return
+            this_class::does_saturate_overflow ?
+                this_class(details::saturate<this_class>(_val),
+                           stored_integer_tag()) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::conversion) &&
+                    details::is_out_of_range_of<this_class>(_val)),
+                 this_class(storage_type(_val), stored_integer_tag()));
     }
     static this_class wrap(float const&) = delete;
     static this_class wrap(double const&) = delete;
 
 
+    /*!
+     \brief Converts the fixed-point number of other format as the converting
+     constructor does, but the dropped low bits are rounded by Rounding (see
+     rounding.hpp) instead of the rounding mode of this format. The events and
+     the saturation are of this format.
+
+     <B>Usage</B>
+
+     \code{.cpp}
+         #include "fixed_point.hpp"
+
+         using Q = libq::Q<15, 12>;
+
+         Q requantize(libq::Q<31, 24> const& _x) {
+             return Q::convert_from<libq::round_half_even>(_x);
+         }
+     \endcode
+    */
+    template<class Rounding,
+             typename T1,
+             std::size_t n1,
+             std::size_t f1,
+             int e1,
+             typename op1,
+             typename up1>
+    static constexpr this_class
+        convert_from(fixed_point<T1, n1, f1, e1, op1, up1> const& _x) {
+        return
+            this_class(
+                this_class::template normalize<Rounding>(_x,
+                    std::integral_constant<bool, (int(f1) + e1 - int(this_class::bits_for_fractional) - this_class::scaling_factor_exponent > 0)>()),  // NOLINT
+                stored_integer_tag());
+    }
+
+
     fixed_point() = default;
     COPY_CTR_EXPLICIT_SPECIFIER fixed_point(this_class const& _x) = default;  // NOLINT
 
 
     /*!
      \brief Normalizes the input fixed-point number to be accepted by current
+     format. The dropped low bits are rounded by the rounding mode of this
      format.
     */
     template<typename T1,
@@ -324,10 +457,10 @@ class fixed_point {
              int e1,
              typename op1,
              typename up1>
-    COPY_CTR_EXPLICIT_SPECIFIER
+    COPY_CTR_EXPLICIT_SPECIFIER constexpr
         fixed_point(fixed_point<T1, n1, f1, e1, op1, up1> const& _x)
         : m_value(
-            this_class::normalize(_x,
+            this_class::template normalize<rounding_mode>(_x,
                 std::integral_constant<bool, (int(f1) + e1 - int(this_class::bits_for_fractional) - this_class::scaling_factor_exponent > 0)>())) { // NOLINT
     }
 
@@ -336,7 +469,7 @@ class fixed_point {
      \brief Creates the fixed-point number from any arithmetic object.
     */
     template<typename T>
-    COPY_CTR_EXPLICIT_SPECIFIER fixed_point(T const& _value)
+    COPY_CTR_EXPLICIT_SPECIFIER constexpr fixed_point(T const& _value)
         : m_value(
             this_class::calc_stored_integer_from(_value,
                                                  std::integral_constant<bool, std::is_floating_point<T>::value>())) {  // NOLINT
@@ -359,7 +492,9 @@ class fixed_point {
                             static_cast<int>(this_class::bits_for_fractional) -
                             this_class::scaling_factor_exponent > 0)>;  // NOLINT
         return
-            this->set_value_to(this_class::normalize(_x, status_type()));
+            this->set_value_to(
+                this_class::template normalize<rounding_mode>(_x,
+                                                              status_type()));  // NOLINT
     }
     this_class& operator =(this_class const& _x) = default;
 
@@ -400,17 +535,26 @@ class fixed_point {
     /*!
      \brief Gets the stored integer behind this fixed-point number.
     */
-    storage_type value() const {
+    constexpr storage_type value() const {
         return this->m_value;
     }
 
 
     // Unfortunately, nobody can use BOOST.Operators here because it cannot
     // handle the template operators
+    //
+    //
+    // The arithmetic operands are compared as the numbers rounded to the
+    // nearest stored integers, the ones beyond the range compare as such. The
+    // fixed-point operands of other formats are compared exactly. Neither
+    // raises the events nor saturates, see order_beyond_range.
 #define COMPARISON_OPERATOR(op)\
     template<typename T>\
-    bool operator op(T const& _x) const {\
-        return this->value() op this_class(_x).value();\
+    constexpr bool operator op(T const& _x) const {\
+        return\
+            (this_class::order_beyond_range(_x) != 0) ?\
+                (this_class::order_beyond_range(_x) op 0) :\
+                (this->left_operand(_x) op this_class::right_operand(_x));\
      }
 
     COMPARISON_OPERATOR(<);  // NOLINT
@@ -421,7 +565,7 @@ class fixed_point {
     COMPARISON_OPERATOR(!=);  // NOLINT
 #undef COMPARISON_OPERATOR
 
-    bool operator !() const {
+    constexpr bool operator !() const {
         return this->value() == 0;
     }
 
@@ -431,15 +575,35 @@ class fixed_point {
      - CONST_2PI is for \f$2 * \pi\f$.
      - CONST_2_PI is for \f$\frac{2}{\pi}\f$.
      - CONST_PI_2 is for \f$\frac{\pi}{2}\f$.
-     \note Weirdly, g++ 5.3.0 needs the full specification of type here.
-     Otherwise, it will not interpret lines 705-707 as declaration instead of
-     definition.
+     \note The constants are wrapped as is. So these do not raise the overflow
+     event if the format is too narrow for the constant.
+     \note The stored integer tag is named through the format, so it is looked
+     up once the class is complete, i.e. at the instantiation.
     */
-    static fixed_point<value_type, n, f, e, op, up> const
-        CONST_E, CONST_LOG2E, CONST_1_LOG2E, CONST_LOG10E, CONST_LOG102,
-        CONST_LN2, CONST_LN10, CONST_2PI, CONST_PI, CONST_PI_2, CONST_PI_4,
-        CONST_1_PI, CONST_2_PI, CONST_2_SQRTPI, CONST_SQRT2, CONST_SQRT1_2,
-        CONST_2SQRT2;
+#define CONSTANT(name, value)\
+    static constexpr fixed_point<value_type, n, f, e, op, up> const name =\
+        fixed_point<value_type, n, f, e, op, up>(\
+            details::constexpr_math::to_stored_integer<fixed_point<value_type, n, f, e, op, up> >(value),  /* NOLINT */\
+            typename fixed_point<value_type, n, f, e, op, up>::stored_integer_tag())  // NOLINT
+
+    CONSTANT(CONST_E, 2.71828182845904523536);
+    CONSTANT(CONST_1_LOG2E, 0.6931471805599453);
+    CONSTANT(CONST_LOG2E, 1.44269504088896340736);
+    CONSTANT(CONST_LOG10E, 0.434294481903251827651);
+    CONSTANT(CONST_LOG102, 0.301029995663981195214);
+    CONSTANT(CONST_LN2, 0.693147180559945309417);
+    CONSTANT(CONST_LN10, 2.30258509299404568402);
+    CONSTANT(CONST_2PI, 6.283185307179586);
+    CONSTANT(CONST_PI, 3.14159265358979323846);
+    CONSTANT(CONST_PI_2, 1.57079632679489661923);
+    CONSTANT(CONST_PI_4, 0.785398163397448309616);
+    CONSTANT(CONST_1_PI, 0.318309886183790671538);
+    CONSTANT(CONST_2_PI, 0.636619772367581343076);
+    CONSTANT(CONST_2_SQRTPI, 1.12837916709551257390);
+    CONSTANT(CONST_SQRT2, 1.41421356237309504880);
+    CONSTANT(CONST_SQRT1_2, 0.707106781186547524401);
+    CONSTANT(CONST_2SQRT2, 2.82842712474619009760);
+#undef CONSTANT
 
 
     /*!
@@ -449,19 +613,37 @@ class fixed_point {
      the result type is equal to std::common_type<L, R>::type = L.
     */
     template<typename T>
-    typename libq::details::sum_traits<this_class>::promoted_type
+    constexpr typename libq::details::sum_traits<this_class>::promoted_type
         operator +(T const& _x) const {
-        using sum_type = typename libq::details::sum_traits<this_class>::promoted_type;  // NOLINT
-        using word_type = typename sum_type::storage_type;
+        return this->add(this_class(_x));
+    }
 
-        this_class const converted(_x);
-        if (details::does_add_overflow(*this, converted)) {
-            overflow_policy::raise_event();
-        }
+    /*!
+     \brief Calculates the exact sum of fixed-point numbers of different
+     formats. Both are aligned to the common format having the finest
+     resolution and the widest range of them plus one bit, so no bit is lost
+     and no check is involved. See details::exact_sum_of.
+     \note If no built-in integer holds the common format then the operand is
+     converted to this format as above.
+    */
+    template<typename T1,
+             std::size_t n1,
+             std::size_t f1,
+             int e1,
+             class op1,
+             class up1,
+             typename traits = libq::details::exact_sum_of<this_class, libq::fixed_point<T1, n1, f1, e1, op1, up1>, false>>  // NOLINT
+    constexpr typename std::enable_if<traits::is_mixed && traits::is_expandable,  // NOLINT
+                                      typename traits::promoted_type>::type
+        operator +(libq::fixed_point<T1, n1, f1, e1, op1, up1> const& _x)
+                                                                        const {
+        using result_type = typename traits::promoted_type;
+        using storage = typename result_type::storage_type;
 
-        word_type const stored_integer = word_type(this->value()) +
-            word_type(converted.value());
-        return sum_type::wrap(stored_integer);
+        return
+            result_type(static_cast<storage>(traits::aligned_left(*this) +
+                                             traits::aligned_right(_x)),
+                        typename result_type::stored_integer_tag());
     }
     template<typename T>
     inline this_class& operator +=(T const& _x) {
@@ -470,6 +652,23 @@ class fixed_point {
         return this->set_value_to(result.value());
     }
 
+    /*!
+     \brief Adds the number of different format as the exact sum above does.
+     The sum is rounded to this format and its range is checked once.
+    */
+    template<typename T1,
+             std::size_t n1,
+             std::size_t f1,
+             int e1,
+             class op1,
+             class up1,
+             typename traits = libq::details::exact_sum_of<this_class, libq::fixed_point<T1, n1, f1, e1, op1, up1>, false>>  // NOLINT
+    typename std::enable_if<traits::is_mixed && traits::is_expandable,
+                            this_class&>::type
+        operator +=(libq::fixed_point<T1, n1, f1, e1, op1, up1> const& _x) {
+        return this->template set_exact_sum_to<traits>((*this + _x).value());
+    }
+
 
     /*!
      \brief Subtracts some numeric object from the current fixed-point number.
@@ -477,19 +676,34 @@ class fixed_point {
      the result type is equal to std::common_type<L, R>::type = L.
     */
     template<typename T>
-    typename libq::details::sum_traits<this_class>::promoted_type
+    constexpr typename libq::details::sum_traits<this_class>::promoted_type
         operator -(T const& _x) const {
-        using diff_type = typename libq::details::sum_traits<this_class>::promoted_type;  // NOLINT
-        using word_type = typename diff_type::storage_type;
+        return this->subtract(this_class(_x));
+    }
 
-        this_class const converted(_x);
-        if (details::does_sub_overflow(*this, converted)) {
-            overflow_policy::raise_event();
-        }
+    /*!
+     \brief Calculates the exact difference of fixed-point numbers of
+     different formats. The difference is signed even for the unsigned
+     operands. See the exact sum above.
+    */
+    template<typename T1,
+             std::size_t n1,
+             std::size_t f1,
+             int e1,
+             class op1,
+             class up1,
+             typename traits = libq::details::exact_sum_of<this_class, libq::fixed_point<T1, n1, f1, e1, op1, up1>, true>>  // NOLINT
+    constexpr typename std::enable_if<traits::is_mixed && traits::is_expandable,  // NOLINT
+                                      typename traits::promoted_type>::type
+        operator -(libq::fixed_point<T1, n1, f1, e1, op1, up1> const& _x)
+                                                                        const {
+        using result_type = typename traits::promoted_type;
+        using storage = typename result_type::storage_type;
 
-        word_type const stored_integer = word_type(this->value()) -
-            word_type(converted.value());
-        return diff_type::wrap(stored_integer);
+        return
+            result_type(static_cast<storage>(traits::aligned_left(*this) -
+                                             traits::aligned_right(_x)),
+                        typename result_type::stored_integer_tag());
     }
     template<typename T>
     this_class operator -=(T const& _x) {
@@ -498,11 +712,30 @@ class fixed_point {
         return this->set_value_to(result.value());
     }
 
+    /*!
+     \brief Subtracts the number of different format as the exact difference
+     above does. See operator +=.
+    */
+    template<typename T1,
+             std::size_t n1,
+             std::size_t f1,
+             int e1,
+             class op1,
+             class up1,
+             typename traits = libq::details::exact_sum_of<this_class, libq::fixed_point<T1, n1, f1, e1, op1, up1>, true>>  // NOLINT
+    typename std::enable_if<traits::is_mixed && traits::is_expandable,
+                            this_class>::type
+        operator -=(libq::fixed_point<T1, n1, f1, e1, op1, up1> const& _x) {
+        return this->template set_exact_sum_to<traits>((*this - _x).value());
+    }
+
 
     /*!
      \brief Multiplies the current fixed-point number with some numeric object.
      \note If no extra significant bits is available for the promoted type then
      the result type is equal to std::common_type<L, R>::type = L.
+     \note The low bits of the product dropped in the latter case are rounded by
+     the rounding mode of the result type, see rounding_policy.
     */
     template<typename T1,
              std::size_t n1,
@@ -510,7 +743,7 @@ class fixed_point {
              int e1,
              class op1,
              class up1>
-    typename libq::details::mult_of<this_class,
+    constexpr typename libq::details::mult_of<this_class,
                                     libq::fixed_point<T1, n1, f1, e1, op1, up1> >::promoted_type  // NOLINT
         operator *(libq::fixed_point<T1, n1, f1, e1, op1, up1> const& _x)
                                                                         const {
@@ -521,14 +754,20 @@ class fixed_point {
         using result_type = typename promotion_traits::promoted_type;
         using word_type = typename promotion_traits::promoted_storage_type;
 
-        if (details::does_mul_overflow(*this, _x)) {
-            overflow_policy::raise_event();
-        }
-
         // do the exact/approximate multiplication of fixed-point numbers
-        return result_type::wrap(
-            (static_cast<word_type>(this->value()) * static_cast<word_type>(_x.value()))  // NOLINT
-                >> (promotion_traits::is_expandable ? 0 : operand_type::bits_for_fractional));  // NOLINT
+        return
+            this_class::does_saturate_overflow ?
+                result_type::wrap(details::saturated_mul(*this, _x)) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::multiplication) &&
+                    details::does_mul_overflow(*this, _x)),
+                 result_type(
+                    static_cast<typename result_type::storage_type>(
+                        result_type::rounding_mode::shift_right(
+                            static_cast<word_type>(this->value()) * static_cast<word_type>(_x.value()),  // NOLINT
+                            promotion_traits::is_expandable ? 0u : static_cast<std::size_t>(operand_type::bits_for_fractional))),  // NOLINT
+                    typename result_type::stored_integer_tag()));
     }
     template<typename T1, std::size_t n1, std::size_t f1, int e1, class op1, class up1>  // NOLINT
     this_class
@@ -543,9 +782,14 @@ class fixed_point {
      \brief Divides the current fixed-point number with some numeric object.
      \note If no extra significant bits is available for the promoted type then
      the result type is equal to std::common_type<L, R>::type = L.
+     \note The quotient is rounded by the rounding mode of the result type, see
+     rounding_policy. The truncation keeps one of the built-in division.
+     \note If the overflow events are reported but not thrown (e.g. by
+     overflow_flag_policy) then the zero divisor gives the quotient saturated
+     towards the sign of the dividend, so no division by zero is done.
     */
     template<typename T1, std::size_t n1, std::size_t f1, int e1, class... Ps>
-    typename libq::details::div_of<this_class, libq::fixed_point<T1, n1, f1, e1, Ps...> >::promoted_type  // NOLINT
+    constexpr typename libq::details::div_of<this_class, libq::fixed_point<T1, n1, f1, e1, Ps...> >::promoted_type  // NOLINT
         operator /(libq::fixed_point<T1, n1, f1, e1, Ps...> const& _x) const {
         using operand_type = typename libq::fixed_point<T1, n1, f1, e1, Ps...>;
         using promotion_traits =
@@ -553,18 +797,30 @@ class fixed_point {
         using result_type = typename promotion_traits::promoted_type;
         using word_type = typename promotion_traits::promoted_storage_type;
 
-        if (details::does_div_overflow(*this, _x)) {
-            overflow_policy::raise_event();
-        }
-
-        word_type const shifted = static_cast<word_type>(this->value()) << operand_type::number_of_significant_bits;  // NOLINT
-        if (!promotion_traits::is_expandable && _x.value() !=
-                (shifted >> operand_type::number_of_significant_bits)) {
-            overflow_policy::raise_event();
-        }
-
         return
-            result_type::wrap(shifted / static_cast<word_type>(_x.value()));
+            this_class::does_saturate_overflow ?
+                result_type::wrap(
+                    this->saturated_quotient<result_type, word_type>(
+                        _x.value(),
+                        operand_type::number_of_significant_bits,
+                        promotion_traits::is_expandable)) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::division) &&
+                    (details::does_div_overflow(*this, _x) ||
+                     (!promotion_traits::is_expandable && this->value() !=
+                        (this->shifted_dividend<word_type>(operand_type::number_of_significant_bits) >> operand_type::number_of_significant_bits)) ||  // NOLINT
+                     details::is_out_of_range_of<result_type>(
+                        result_type::rounding_mode::divide(this->shifted_dividend<word_type>(operand_type::number_of_significant_bits), static_cast<word_type>(_x.value()))))),  // NOLINT
+                 result_type(
+                    (this_class::does_check_overflow && _x.value() == 0) ?
+                        this->saturated_quotient<result_type, word_type>(
+                            _x.value(),
+                            operand_type::number_of_significant_bits,
+                            promotion_traits::is_expandable) :
+                        static_cast<typename result_type::storage_type>(
+                            result_type::rounding_mode::divide(this->shifted_dividend<word_type>(operand_type::number_of_significant_bits), static_cast<word_type>(_x.value()))),  // NOLINT
+                    typename result_type::stored_integer_tag()));
     }
     template<typename T1, std::size_t n1, std::size_t f1, int e1, class... Ps>
     this_class
@@ -578,39 +834,149 @@ class fixed_point {
     /*!
      \brief Gets the negative value of the current fixed-point number.
     */
-    this_class operator -() const {
-        if (details::does_unary_neg_overflow(*this)) {
-            overflow_policy::raise_event();
-        }
-
-        return this_class::wrap(-this->value());
+    constexpr this_class operator -() const {
+        return
+            this_class::does_saturate_overflow ?
+                this_class(
+                    !this_class::is_signed ? storage_type(0) :
+                    (this->value() == this_class::least_stored_integer) ?
+                        static_cast<storage_type>(this_class::largest_stored_integer) :  // NOLINT
+                        static_cast<storage_type>(-this->value()),
+                    stored_integer_tag()) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::negation) &&
+                    details::does_unary_neg_overflow(*this)),
+                 this_class(static_cast<storage_type>(-this->value()),
+                            stored_integer_tag()));
     }
 
  private:
+    /*!
+     \brief Tags the constructor that takes the stored integer as is.
+    */
+    struct stored_integer_tag {};
+    constexpr fixed_point(storage_type const _x, stored_integer_tag)
+        : m_value(_x) {
+    }
+
+    template<typename T1, std::size_t n1, std::size_t f1, int e1, class op1, class up1>  // NOLINT
+    friend class fixed_point;
+
+
+    /*!
+     \brief These check if the range checks of the current operation are run.
+     The sampling policies pick 1 in N operations of each kind, the others
+     pick all.
+    */
+    static constexpr bool
+        checks_overflow(details::checked_operation const _operation) {
+        return this_class::does_check_overflow &&
+               details::event_sampling<overflow_policy>::is_sampled(_operation);  // NOLINT
+    }
+    static constexpr bool
+        checks_underflow(details::checked_operation const _operation) {
+        return this_class::does_check_underflow &&
+               details::event_sampling<underflow_policy>::is_sampled(_operation);  // NOLINT
+    }
+
+
+    constexpr typename libq::details::sum_traits<this_class>::promoted_type
+        add(this_class const& _x) const {
+        using sum_type = typename libq::details::sum_traits<this_class>::promoted_type;  // NOLINT
+        using word_type = typename sum_type::storage_type;
+
+        return
+            this_class::does_saturate_overflow ?
+                sum_type::wrap(details::saturated_add(*this, _x)) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::addition) &&
+                    details::does_add_overflow(*this, _x)),
+                 sum_type(static_cast<typename sum_type::storage_type>(
+                            word_type(this->value()) + word_type(_x.value())),  // NOLINT
+                          typename sum_type::stored_integer_tag()));
+    }
+
+
+    constexpr typename libq::details::sum_traits<this_class>::promoted_type
+        subtract(this_class const& _x) const {
+        using diff_type = typename libq::details::sum_traits<this_class>::promoted_type;  // NOLINT
+        using word_type = typename diff_type::storage_type;
+
+        return
+            this_class::does_saturate_overflow ?
+                diff_type::wrap(details::saturated_sub(*this, _x)) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::subtraction) &&
+                    details::does_sub_overflow(*this, _x)),
+                 diff_type(static_cast<typename diff_type::storage_type>(
+                            word_type(this->value()) - word_type(_x.value())),  // NOLINT
+                           typename diff_type::stored_integer_tag()));
+    }
+
+
+    /*!
+     \brief Gets the stored integer scaled up to be divided.
+    */
+    template<typename word_type>
+    constexpr word_type shifted_dividend(std::size_t const _shifts) const {
+        return
+            details::shift_left(static_cast<word_type>(this->value()), _shifts);
+    }
+
+
+    /*!
+     \brief Gets the stored integer of the quotient being saturated to the
+     range of the result format.
+    */
+    template<typename result_type, typename word_type, typename T1>
+    constexpr typename result_type::storage_type
+        saturated_quotient(T1 const _divisor,
+                           std::size_t const _shifts,
+                           bool const _is_expandable) const {
+        return
+            (_divisor == 0 ||
+             (!_is_expandable && static_cast<word_type>(this->value()) !=
+                (this->shifted_dividend<word_type>(_shifts) >> _shifts)) ||
+             (std::numeric_limits<T1>::is_signed && _divisor < 0 &&
+              static_cast<word_type>(_divisor) == word_type(-1) &&
+                this->shifted_dividend<word_type>(_shifts) ==
+                    std::numeric_limits<word_type>::min())) ?
+                (((this->value() < 0) != (_divisor < 0)) ?
+                    details::saturate<result_type>(result_type::least_stored_integer) :  // NOLINT
+                    details::saturate<result_type>(result_type::largest_stored_integer)) :  // NOLINT
+                details::saturate<result_type>(
+                    result_type::rounding_mode::divide(
+                        this->shifted_dividend<word_type>(_shifts),
+                        static_cast<word_type>(_divisor)));
+    }
+
+
     /*!
      \brief Represents some floating-point number as a fixed-point number.
      \note It uses the rounding-to-nearest logics in case of floating-point
      types.
     */
     template<typename T>
-    static storage_type
+    static constexpr storage_type
         calc_stored_integer_from(T const& _x, std::true_type) {
-        double const scale = static_cast<double>(
-                                          this_class::scaling_factor_exponent);
-        double const value = static_cast<double>(_x) / details::exp2(scale);
-        if (_x > T(0)) {
-            storage_type const converted = static_cast<storage_type>(
-                                  std::floor(value * this_class::scale + 0.5));
-            if (converted < 0) {
-                overflow_policy::raise_event();
-            }
-
-            return converted;
-        }
-
         return
-            static_cast<storage_type>(
-                                   std::ceil(value * this_class::scale - 0.5));
+            this_class::does_saturate_overflow ?
+                (this_class::is_above_range(static_cast<double>(_x)) ?
+                    static_cast<storage_type>(this_class::largest_stored_integer) :  // NOLINT
+                 this_class::is_below_range(static_cast<double>(_x)) ?
+                    static_cast<storage_type>(this_class::least_stored_integer) :  // NOLINT
+                    details::constexpr_math::to_stored_integer<this_class>(
+                                                  static_cast<double>(_x))) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::conversion) &&
+                    static_cast<double>(_x) * details::constexpr_math::scale_of<this_class>::value + 0.5 >=  // NOLINT
+                        details::constexpr_math::pow2(std::numeric_limits<storage_type>::digits)),  // NOLINT
+                 details::constexpr_math::to_stored_integer<this_class>(
+                                                  static_cast<double>(_x)));
     }
 
 
@@ -618,12 +984,87 @@ class fixed_point {
      \brief Represents some integral number as a fixed-point number.
     */
     template<typename T>
-    static storage_type
+    static constexpr storage_type
         calc_stored_integer_from(T const& _x, std::false_type) {
-        double const scale = static_cast<double>(
-                                          this_class::scaling_factor_exponent);
-        double const value = static_cast<double>(_x) / details::exp2(scale);
-        return storage_type(value) << this_class::bits_for_fractional;
+        return
+            (this_class::does_saturate_overflow &&
+             this_class::is_above_range(static_cast<double>(_x))) ?
+                static_cast<storage_type>(this_class::largest_stored_integer) :
+            (this_class::does_saturate_overflow &&
+             this_class::is_below_range(static_cast<double>(_x))) ?
+                static_cast<storage_type>(this_class::least_stored_integer) :
+                details::shift_left(
+                    static_cast<storage_type>(static_cast<double>(_x) * details::constexpr_math::pow2(this_class::scaling_factor_exponent)),  // NOLINT
+                    this_class::bits_for_fractional);
+    }
+
+
+    /*!
+     \brief Gets the order of this number and _x being beyond the range of
+     this format, i.e. -1 or 1 if _x is above or below any number of this
+     format, and 0 otherwise.
+     \note The numbers within the range are rounded to the stored integers as
+     the converting constructor does, but no event is raised. The literals are
+     rounded at compile time, so the comparison takes one integer compare.
+    */
+    template<typename T>
+    static constexpr int order_beyond_range(T const& _x) {
+        return
+            this_class::is_above_range(static_cast<double>(_x)) ? -1 :
+            this_class::is_below_range(static_cast<double>(_x)) ? 1 : 0;
+    }
+
+    template<typename T1, std::size_t n1, std::size_t f1, int e1, class op1, class up1>  // NOLINT
+    static constexpr int
+        order_beyond_range(fixed_point<T1, n1, f1, e1, op1, up1> const&) {
+        return 0;
+    }
+
+    /*!
+     \brief Gets the stored integers of this number and _x of the same scale.
+     The fixed-point numbers of other formats are aligned by the shifts known
+     at compile time, see details::comparison_of.
+    */
+    template<typename T>
+    constexpr storage_type left_operand(T const&) const {
+        return this->value();
+    }
+
+    template<typename T1, std::size_t n1, std::size_t f1, int e1, class op1, class up1>  // NOLINT
+    constexpr typename details::comparison_of<this_class, fixed_point<T1, n1, f1, e1, op1, up1> >::storage_type  // NOLINT
+        left_operand(fixed_point<T1, n1, f1, e1, op1, up1> const&) const {
+        return
+            details::comparison_of<this_class, fixed_point<T1, n1, f1, e1, op1, up1> >::left(*this);  // NOLINT
+    }
+
+    template<typename T>
+    static constexpr storage_type right_operand(T const& _x) {
+        return
+            details::constexpr_math::to_stored_integer<this_class>(
+                static_cast<double>(_x));
+    }
+
+    template<typename T1, std::size_t n1, std::size_t f1, int e1, class op1, class up1>  // NOLINT
+    static constexpr typename details::comparison_of<this_class, fixed_point<T1, n1, f1, e1, op1, up1> >::storage_type  // NOLINT
+        right_operand(fixed_point<T1, n1, f1, e1, op1, up1> const& _x) {
+        return
+            details::comparison_of<this_class, fixed_point<T1, n1, f1, e1, op1, up1> >::right(_x);  // NOLINT
+    }
+
+
+    /*!
+     \brief These check if the number being rounded to the nearest stored
+     integer gets beyond the range of this format.
+    */
+    static constexpr bool is_above_range(double const _x) {
+        return
+            _x * details::constexpr_math::scale_of<this_class>::value >=
+                static_cast<double>(this_class::largest_stored_integer) + 0.5;
+    }
+    static constexpr bool is_below_range(double const _x) {
+        return
+            _x * details::constexpr_math::scale_of<this_class>::value <=
+                static_cast<double>(this_class::least_stored_integer) - 0.5;
     }
 
 
@@ -631,47 +1072,119 @@ class fixed_point {
      \brief Normalizes the input fixed-point number to one of the current
      format in case \f$f + e - f1 - e1 > 0\f$.
     */
-    template<typename T1, std::size_t n1, std::size_t f1, int e1, class... Ps>
-    static storage_type normalize(fixed_point<T1, n1, f1, e1, Ps...> const& _x,
-                                  std::false_type) {
-        static std::size_t const shifts =
-            (static_cast<int>(this_class::bits_for_fractional) + this_class::scaling_factor_exponent) -  // NOLINT
-            (static_cast<int>(e1) + f1);
-        storage_type const normalized = storage_type(_x.value()) << shifts;
-
-        if (_x.value() != (normalized >> shifts)) {
-            overflow_policy::raise_event();
-        }
-        return normalized;
+    template<class Rounding, typename T1, std::size_t n1, std::size_t f1, int e1, class... Ps>  // NOLINT
+    static constexpr storage_type
+        normalize(fixed_point<T1, n1, f1, e1, Ps...> const& _x,
+                  std::false_type) {
+        return
+            this_class::shift_left_checked(_x.value(),
+                (static_cast<int>(this_class::bits_for_fractional) + this_class::scaling_factor_exponent) -  // NOLINT
+                (static_cast<int>(e1) + f1));
     }
 
 
     /*!
      \brief Normalizes the input fixed-point number to one of the current
-     format in case \f$f + e - f1 - e1 < 0\f$.
+     format in case \f$f + e - f1 - e1 < 0\f$. The dropped bits are rounded
+     by Rounding.
     */
-    template<typename T1, std::size_t n1, std::size_t f1, int e1, class... Ps>
-    static storage_type normalize(fixed_point<T1, n1, f1, e1, Ps...> const& _x,
-                                  std::true_type) {
-        static std::size_t const shifts =
-            (static_cast<int>(e1) + f1) -
-            (static_cast<int>(this_class::bits_for_fractional) + this_class::scaling_factor_exponent);  // NOLINT
-        storage_type const normalized =
-            static_cast<storage_type>(_x.value() >> shifts);
-
-        if (_x.value() && !normalized) {
-            underflow_policy::raise_event();
-        }
-        return normalized;
+    template<class Rounding, typename T1, std::size_t n1, std::size_t f1, int e1, class... Ps>  // NOLINT
+    static constexpr storage_type
+        normalize(fixed_point<T1, n1, f1, e1, Ps...> const& _x,
+                  std::true_type) {
+        return
+            this_class::template shift_right_checked<Rounding>(_x.value(),
+                (static_cast<int>(e1) + f1) -
+                (static_cast<int>(this_class::bits_for_fractional) + this_class::scaling_factor_exponent));  // NOLINT
+    }
+
+
+    /*!
+     \brief Shifts the stored integer of other format to the left. This raises
+     the overflow event if some significant bits are lost or the result is
+     beyond the range of this format. In case of saturation, the result is
+     clamped to the range of this format.
+    */
+    template<typename T1>
+    static constexpr storage_type shift_left_checked(T1 const _x,
+                                                     std::size_t const _shifts) {  // NOLINT
+        return
+            (this_class::does_saturate_overflow && _shifts == 0) ?
+                details::saturate<this_class>(_x) :
+            this_class::does_saturate_overflow ?
+                (details::is_below(this_class::largest_stored_integer >> _shifts, _x) ?  // NOLINT
+                    static_cast<storage_type>(this_class::largest_stored_integer) :  // NOLINT
+                 (_x < 0 && (!this_class::is_signed || details::is_below(_x, this_class::least_shifted_right(_shifts)))) ?  // NOLINT
+                    static_cast<storage_type>(this_class::least_stored_integer) :  // NOLINT
+                    details::shift_left(storage_type(_x), _shifts)) :
+                (details::raise_event_if<overflow_policy>(
+                    this_class::checks_overflow(
+                        details::checked_operation::conversion) &&
+                    (details::differs(_x, details::shift_left(storage_type(_x), _shifts) >> _shifts) ||  // NOLINT
+                     details::is_out_of_range_of<this_class>(
+                        details::shift_left(storage_type(_x), _shifts)))),
+                 details::shift_left(storage_type(_x), _shifts));
+    }
+
+
+    /*!
+     \brief Gets the least integer x such that \f$x \cdot 2^{shifts}\f$ is
+     not below the range of this signed format.
+    */
+    static constexpr least_type least_shifted_right(std::size_t const _shifts) {  // NOLINT
+        return
+            -static_cast<least_type>(this_class::largest_stored_integer >> _shifts) -  // NOLINT
+                static_cast<least_type>(_shifts <= this_class::number_of_significant_bits);  // NOLINT
+    }
+
+
+    /*!
+     \brief Shifts the stored integer of other format to the right rounding
+     the dropped bits by Rounding. This raises the underflow event if the
+     non-zero number turns into zero and the overflow event if the result is
+     beyond the range of this format.
+    */
+    template<class Rounding, typename T1>
+    static constexpr storage_type shift_right_checked(T1 const _x,
+                                                      std::size_t const _shifts) {  // NOLINT
+        return
+            this_class::checked_shifted_right(_x,
+                                              Rounding::shift_right(_x, _shifts));  // NOLINT
+    }
+
+    /*!
+     \brief Checks the stored integer being shifted to the right. The rounded
+     one is computed once, so the stochastic rounding is checked as is.
+    */
+    template<typename T1>
+    static constexpr storage_type checked_shifted_right(T1 const _x,
+                                                        T1 const _shifted) {
+        return
+            (details::raise_event_if<overflow_policy>(
+                this_class::checks_overflow(
+                    details::checked_operation::conversion) &&
+                details::is_out_of_range_of<this_class>(_shifted)),
+             details::raise_event_if<underflow_policy>(
+                this_class::checks_underflow(
+                    details::checked_operation::conversion) &&
+                _x && !static_cast<storage_type>(_shifted)),
+             this_class::does_saturate_overflow ?
+                details::saturate<this_class>(_shifted) :
+                static_cast<storage_type>(_shifted));
     }
 
 
     /*!
      \brief Converts the fixed-point number to the floating-point number.
+     \note The stored integer is multiplied by the constant \f$2^{-(f + e)}\f$,
+     i.e. this inverts the conversion from the floating-point numbers. No
+     division is involved and the result is exact for the stored integers of
+     up to 53 bits.
     */
     double to_floating_point() const {
         return
-            this->scaling_factor() * static_cast<double>(value()) / this_class::scale;  // NOLINT
+            static_cast<double>(this->value()) *
+            details::constexpr_math::scale_of<this_class>::inverse;
     }
 
 
@@ -680,16 +1193,39 @@ class fixed_point {
      \brief This also checks if the stored integer is within the range of
      current fixed-point number.
     */
-    this_class& set_value_to(storage_type const _x) {
-        if (_x < this_class::least_stored_integer ||
-            _x > this_class::largest_stored_integer) {
+    template<typename T1>
+    this_class& set_value_to(T1 const _x) {
+        if (this_class::checks_overflow(
+                details::checked_operation::assignment) &&
+            details::is_out_of_range_of<this_class>(_x)) {
             overflow_policy::raise_event();
         }
 
-        this->m_value = _x;
+        this->m_value = this_class::does_saturate_overflow ?
+            details::saturate<this_class>(_x) : static_cast<storage_type>(_x);
         return *this;
     }
 
+    /*!
+     \brief Rounds the stored integer of the exact sum or difference (see
+     details::exact_sum_of) to this format and assigns it. The sum is never
+     coarser than this format, so it is shifted to the right only, and the
+     range is checked on the rounded sum as is.
+    */
+    template<class traits>
+    this_class& set_exact_sum_to(typename traits::storage_type const _x) {
+        using word_type = typename traits::storage_type;
+
+        word_type const rounded =
+            rounding_mode::shift_right(_x, traits::shifts1);
+        details::raise_event_if<underflow_policy>(
+            this_class::checks_underflow(
+                details::checked_operation::conversion) &&
+            _x && !rounded);
+
+        return this->set_value_to(rounded);
+    }
+
     friend storage_type& lift<value_type, n, f, e, overflow_policy, underflow_policy>(this_class&);  // NOLINT
 };
 
@@ -698,44 +1234,49 @@ class fixed_point {
  n and f.
 */
 template<std::size_t n, std::size_t f, int e = 0, class op = libq::ignorance_policy, class up = libq::ignorance_policy>  // NOLINT
-using Q = libq::fixed_point<typename boost::int_t<n+1>::least, n-f, f, e, op, up>;  // NOLINT
+using Q = libq::fixed_point<typename details::int_least<n+1>::type, n-f, f, e, op, up>;  // NOLINT
 
 /*!
  \brief Short-cut for the unsigned fixed-point with just 2 template parameters
  n and f.
 */
 template<std::size_t n, std::size_t f, int e = 0, class op = libq::ignorance_policy, class up = libq::ignorance_policy>  // NOLINT
-using UQ = libq::fixed_point<typename boost::uint_t<n>::least, n-f, f, e, op, up>;  // NOLINT
+using UQ = libq::fixed_point<typename details::uint_least<n>::type, n-f, f, e, op, up>;  // NOLINT
 
 
-#define CONSTANT(name, value)\
+/*!
+ \brief Defines the constant initialized in the class, so it has the address.
+*/
+#define CONSTANT(name)\
     template<class T, std::size_t n, std::size_t f, int e, class op, class up>\
-    fixed_point<T, n, f, e, op, up> const fixed_point<T, n, f, e, op, up>::name(value);  // NOLINT
-
-
-CONSTANT(CONST_E, 2.71828182845904523536)
-CONSTANT(CONST_1_LOG2E, 0.6931471805599453)
-CONSTANT(CONST_LOG2E, 1.44269504088896340736)
-CONSTANT(CONST_LOG10E, 0.434294481903251827651)
-CONSTANT(CONST_LOG102, 0.301029995663981195214)
-CONSTANT(CONST_LN2, 0.693147180559945309417)
-CONSTANT(CONST_LN10, 2.30258509299404568402)
-CONSTANT(CONST_2PI, 6.283185307179586)
-CONSTANT(CONST_PI, 3.14159265358979323846)
-CONSTANT(CONST_PI_2, 1.57079632679489661923)
-CONSTANT(CONST_PI_4, 0.785398163397448309616)
-CONSTANT(CONST_1_PI, 0.318309886183790671538)
-CONSTANT(CONST_2_PI, 0.636619772367581343076)
-CONSTANT(CONST_2_SQRTPI, 1.12837916709551257390)
-CONSTANT(CONST_SQRT2, 1.41421356237309504880)
-CONSTANT(CONST_SQRT1_2, 0.707106781186547524401)
-CONSTANT(CONST_2SQRT2, 2.82842712474619009760)
+    constexpr fixed_point<T, n, f, e, op, up> const fixed_point<T, n, f, e, op, up>::name;  // NOLINT
+
+
+CONSTANT(CONST_E)
+CONSTANT(CONST_1_LOG2E)
+CONSTANT(CONST_LOG2E)
+CONSTANT(CONST_LOG10E)
+CONSTANT(CONST_LOG102)
+CONSTANT(CONST_LN2)
+CONSTANT(CONST_LN10)
+CONSTANT(CONST_2PI)
+CONSTANT(CONST_PI)
+CONSTANT(CONST_PI_2)
+CONSTANT(CONST_PI_4)
+CONSTANT(CONST_1_PI)
+CONSTANT(CONST_2_PI)
+CONSTANT(CONST_2_SQRTPI)
+CONSTANT(CONST_SQRT2)
+CONSTANT(CONST_SQRT1_2)
+CONSTANT(CONST_2SQRT2)
 
 #undef CONSTANT
 }  // namespace libq
 
 
 #include "details/sum_traits.inl"
+#include "details/accumulator_of.inl"
+#include "details/exact_sum_of.inl"
 #include "details/mult_of.inl"
 #include "details/div_of.inl"
 
@@ -747,6 +1288,8 @@ CONSTANT(CONST_2SQRT2, 2.82842712474619009760)
 #include "details/round.inl"
 #include "details/remainder.inl"
 #include "details/fmod.inl"
+#include "details/fma.inl"
+#include "details/divider.inl"
 #include "details/numeric_limits.inl"
 #include "details/type_traits.inl"
 
@@ -760,20 +1303,33 @@ CONSTANT(CONST_2SQRT2, 2.82842712474619009760)
 
 #include "CORDIC/sin.inl"
 #include "CORDIC/cos.inl"
+#include "CORDIC/sincos.inl"
 #include "CORDIC/tan.inl"
 
 #include "CORDIC/exp.inl"
+#include "CORDIC/exp2.inl"
 
 #include "CORDIC/sinh.inl"
 #include "CORDIC/cosh.inl"
 #include "CORDIC/tanh.inl"
+#include "CORDIC/sinhcosh.inl"
 
 #include "CORDIC/acos.inl"
 #include "CORDIC/asin.inl"
 #include "CORDIC/atan.inl"
+#include "CORDIC/atan2.inl"
+#include "CORDIC/hypot.inl"
+#include "CORDIC/polar.inl"
 
 #include "CORDIC/asinh.inl"
 #include "CORDIC/acosh.inl"
 #include "CORDIC/atanh.inl"
 
+#include "span.hpp"
+
+#include "batch/dispatch.inl"
+#include "batch/arithmetics.inl"
+#include "batch/conversions.inl"
+#include "batch/reductions.inl"
+
 #endif  // INC_LIBQ_FIXED_POINT_HPP_
@@ -0,0 +1,381 @@
+// rounding.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file rounding.hpp
+
+ Provides the rounding modes of the stored integers losing their low bits,
+ e.g. when the number is converted to the format of fewer fractional bits, and
+ the policy selecting the rounding mode of the fixed-point format.
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    // the products and the quotients are rounded to nearest-even, the
+    // underflows are flagged
+    using Q = libq::Q<15, 8, 0,
+                      libq::saturation_policy,
+                      libq::rounding_policy<libq::round_half_even,
+                                            libq::underflow_flag_policy> >;
+ \endcode
+*/
+
+#ifndef INC_LIBQ_ROUNDING_HPP_
+#define INC_LIBQ_ROUNDING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include "arithmetics_safety.hpp"
+
+namespace libq {
+namespace details {
+
+/*!
+ \brief Rounds the quotients truncated towards zero by the built-in division.
+*/
+class quotient_rounding {
+ public:
+    template<typename T>
+    static constexpr typename std::make_unsigned<T>::type
+        magnitude(T const _x) {
+        using word_type = typename std::make_unsigned<T>::type;
+
+        return (_x < 0) ? word_type(0u) - static_cast<word_type>(_x) :
+                          static_cast<word_type>(_x);
+    }
+
+    /*!
+     \brief Checks if the exact quotient is above the truncated one, i.e. the
+     remainder and the divisor are of the same sign.
+    */
+    template<typename T>
+    static constexpr bool is_above(T const _remainder, T const _y) {
+        return (_remainder < 0) == (_y < 0);
+    }
+
+    /*!
+     \brief Steps the truncated quotient by one unit towards the exact one.
+    */
+    template<typename T>
+    static constexpr T stepped(T const _quotient,
+                               T const _remainder,
+                               T const _y,
+                               bool const _is_stepped) {
+        return
+            !_is_stepped ? _quotient :
+            quotient_rounding::is_above(_remainder, _y) ?
+                static_cast<T>(_quotient + T(1)) :
+                static_cast<T>(_quotient - T(1));
+    }
+
+    /*!
+     \brief Checks if the remainder is above the half of divisor, i.e.
+     \f$|r| > |y| - |r|\f$ (the doubled remainder may overflow).
+    */
+    template<typename T>
+    static constexpr bool is_above_half(T const _remainder, T const _y) {
+        return
+            quotient_rounding::magnitude(_remainder) >
+                quotient_rounding::magnitude(_y) -
+                    quotient_rounding::magnitude(_remainder);
+    }
+
+    template<typename T>
+    static constexpr bool is_half(T const _remainder, T const _y) {
+        return
+            quotient_rounding::magnitude(_remainder) ==
+                quotient_rounding::magnitude(_y) -
+                    quotient_rounding::magnitude(_remainder);
+    }
+};
+
+}  // namespace details
+
+
+/*!
+ \brief Drops the low bits, i.e. rounds towards minus infinity. This is the
+ plain arithmetic right shift, so it costs least. The quotients are truncated
+ towards zero as the built-in division does.
+*/
+class truncation {
+ public:
+    enum: bool {
+        is_deterministic = true
+    };
+
+    template<typename T>
+    static constexpr T shift_right(T const _x, std::size_t const _shifts) {
+        return static_cast<T>(_x >> _shifts);
+    }
+
+    template<typename T>
+    static constexpr T divide(T const _x, T const _y) {
+        return static_cast<T>(_x / _y);
+    }
+};
+
+
+/*!
+ \brief Rounds to nearest, the halfway cases are rounded towards plus
+ infinity.
+ \note The highest dropped bit is added to the kept ones, so the rounding
+ never overflows the integer.
+*/
+class round_half_up {
+    using rounding = details::quotient_rounding;
+
+ public:
+    enum: bool {
+        is_deterministic = true
+    };
+
+    template<typename T>
+    static constexpr T shift_right(T const _x, std::size_t const _shifts) {
+        return
+            (_shifts == 0u) ? _x :
+                static_cast<T>((_x >> _shifts) +
+                               ((_x >> (_shifts - 1u)) & T(1)));
+    }
+
+    template<typename T>
+    static constexpr T divide(T const _x, T const _y) {
+        return
+            rounding::stepped(static_cast<T>(_x / _y),
+                              static_cast<T>(_x % _y),
+                              _y,
+                              rounding::is_above_half(static_cast<T>(_x % _y), _y) ||  // NOLINT
+                                (rounding::is_above(static_cast<T>(_x % _y), _y) &&  // NOLINT
+                                 rounding::is_half(static_cast<T>(_x % _y), _y)));  // NOLINT
+    }
+};
+
+
+/*!
+ \brief Rounds to nearest, the halfway cases are rounded to the even integer
+ (the convergent rounding). Unlike the other modes, this has no bias.
+ \note The kept integer q is incremented if the dropped bits r are above the
+ half or equal to it while q is odd, i.e. if r + (q & 1) is above the half.
+ The sum never overflows, and the comparison is vectorized unlike the bitwise
+ tests of the dropped bits.
+*/
+class round_half_even {
+    using rounding = details::quotient_rounding;
+
+ public:
+    enum: bool {
+        is_deterministic = true
+    };
+
+    template<typename T>
+    static constexpr T shift_right(T const _x, std::size_t const _shifts) {
+        return
+            (_shifts == 0u) ? _x :
+                static_cast<T>((_x >> _shifts) +
+                    static_cast<T>(
+                        ((static_cast<word_type<T> >(_x) & round_half_even::low_bits_mask<T>(_shifts)) +  // NOLINT
+                            (static_cast<word_type<T> >(_x >> _shifts) & word_type<T>(1u))) >  // NOLINT
+                        (word_type<T>(1u) << (_shifts - 1u))));
+    }
+
+    template<typename T>
+    static constexpr T divide(T const _x, T const _y) {
+        return
+            rounding::stepped(static_cast<T>(_x / _y),
+                              static_cast<T>(_x % _y),
+                              _y,
+                              rounding::is_above_half(static_cast<T>(_x % _y), _y) ||  // NOLINT
+                                (rounding::is_half(static_cast<T>(_x % _y), _y) &&  // NOLINT
+                                 ((_x / _y) & T(1)) != 0));
+    }
+
+ private:
+    // the dropped bits are compared within the unsigned word, so the shifts
+    // by the digits of the signed T are defined
+    template<typename T>
+    using word_type = typename std::make_unsigned<T>::type;
+
+    template<typename T>
+    static constexpr word_type<T> low_bits_mask(std::size_t const _bits) {
+        return static_cast<word_type<T> >(
+            (word_type<T>(1u) << _bits) - word_type<T>(1u));
+    }
+};
+
+
+/*!
+ \brief Rounds up with the probability equal to the dropped fraction, so the
+ rounding errors have zero mean and do not accumulate along the long chains
+ of operations (e.g. the filters and the gradient updates).
+ \note The random bits are drawn from the thread-local SplitMix64 generator.
+ Its sequence starts with the same state in every thread unless seed() is
+ called, so the runs are reproducible.
+ \note The results are not the same from call to call, so the batch
+ operations run the scalar loops for such formats. The range checks run with
+ the rounded results of the conversions, but the quotients and the products of
+ the non-expandable formats are checked with their own random bits.
+*/
+class stochastic_rounding {
+    using rounding = details::quotient_rounding;
+
+ public:
+    enum: bool {
+        is_deterministic = false
+    };
+
+    static void seed(std::uint64_t const _seed) {
+        stochastic_rounding::state() = _seed;
+    }
+
+    /*!
+     \brief Adds the random bits to the dropped ones, so the carry rounds the
+     kept integer up with the probability of \f$r / 2^{shifts}\f$.
+    */
+    template<typename T>
+    static T shift_right(T const _x, std::size_t const _shifts) {
+        using word_type = typename std::make_unsigned<T>::type;
+
+        word_type const mask = static_cast<word_type>(
+            (word_type(1u) << _shifts) - word_type(1u));
+        return
+            (_shifts == 0u) ? _x :
+                static_cast<T>((_x >> _shifts) +
+                    static_cast<T>(
+                        ((static_cast<word_type>(_x) & mask) +
+                         (stochastic_rounding::random_word<word_type>() & mask)) >>  // NOLINT
+                        _shifts));
+    }
+
+    /*!
+     \brief Steps the truncated quotient towards the exact one with the
+     probability of \f$|r| / |y|\f$.
+    */
+    template<typename T>
+    static T divide(T const _x, T const _y) {
+        using word_type = typename std::make_unsigned<T>::type;
+
+        return
+            rounding::stepped(static_cast<T>(_x / _y),
+                              static_cast<T>(_x % _y),
+                              _y,
+                              stochastic_rounding::random_word<word_type>() %
+                                  rounding::magnitude(_y) <
+                              rounding::magnitude(static_cast<T>(_x % _y)));
+    }
+
+ private:
+    static std::uint64_t& state() {
+        static thread_local std::uint64_t value = 0x9E3779B97F4A7C15u;
+
+        return value;
+    }
+
+    static std::uint64_t next() {
+        std::uint64_t z = (stochastic_rounding::state() += 0x9E3779B97F4A7C15u);  // NOLINT
+        z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9u;
+        z = (z ^ (z >> 27u)) * 0x94D049BB133111EBu;
+
+        return z ^ (z >> 31u);
+    }
+
+    template<typename U>
+    static U random_word() {
+        return stochastic_rounding::random_word<U>(
+            std::integral_constant<bool,
+                (std::numeric_limits<U>::digits > 64)>());
+    }
+
+    template<typename U>
+    static U random_word(std::false_type) {
+        return static_cast<U>(stochastic_rounding::next());
+    }
+
+    template<typename U>
+    static U random_word(std::true_type) {
+        return
+            static_cast<U>(
+                (static_cast<U>(stochastic_rounding::next()) << 64u) |
+                static_cast<U>(stochastic_rounding::next()));
+    }
+};
+
+
+/*!
+ \brief Selects the rounding mode of the format: the conversions from the
+ formats of more fractional bits, the products and the quotients round their
+ dropped bits by Rounding. The underflow events are reported through Policy,
+ so this takes the place of the underflow policy of the format.
+ \note The formats having the plain underflow policies truncate the dropped
+ bits, see libq::truncation. The conversions from the floating-point numbers
+ always round to nearest.
+*/
+template<class Rounding, class Policy = libq::ignorance_policy>
+class rounding_policy {
+    using this_class = rounding_policy<Rounding, Policy>;
+
+ public:
+    using rounding_mode = Rounding;
+    using reporting_policy = Policy;
+
+    enum: bool {
+        does_throw = Policy::does_throw
+    };
+
+    static void raise_event() {
+        Policy::raise_event();
+    }
+
+    static void raise_event(std::string const& _msg) {
+        Policy::raise_event(_msg);
+    }
+};
+
+
+namespace details {
+
+/*!
+ \brief Gets the rounding mode selected by the underflow policy.
+*/
+template<class Policy>
+class rounding_of {
+ public:
+    using type = libq::truncation;
+};
+
+template<class Rounding, class Policy>
+class rounding_of<libq::rounding_policy<Rounding, Policy> > {
+ public:
+    using type = Rounding;
+};
+
+
+// the events are handled by the wrapped policy
+template<class Rounding, class Policy>
+class is_ignorance_policy<libq::rounding_policy<Rounding, Policy> >
+    : public is_ignorance_policy<Policy> {
+};
+
+template<class Rounding, class Policy>
+class is_saturation_policy<libq::rounding_policy<Rounding, Policy> >
+    : public is_saturation_policy<Policy> {
+};
+
+template<class Rounding, class Policy>
+class is_sampling_policy<libq::rounding_policy<Rounding, Policy> >
+    : public is_sampling_policy<Policy> {
+};
+
+template<class Rounding, class Policy>
+class event_sampling<libq::rounding_policy<Rounding, Policy> >
+    : public event_sampling<Policy> {
+};
+
+}  // namespace details
+}  // namespace libq
+
+#endif  // INC_LIBQ_ROUNDING_HPP_
@@ -0,0 +1,133 @@
+// span.hpp
+//
+// Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+// Distributed under the New BSD License. (See accompanying file LICENSE)
+
+/*!
+ \file span.hpp
+
+ Provides the non-owning view of the contiguous sequence of objects. It is
+ used by the batch operations over the arrays of fixed-point numbers.
+*/
+
+#ifndef INC_LIBQ_SPAN_HPP_
+#define INC_LIBQ_SPAN_HPP_
+
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <type_traits>
+
+namespace libq {
+
+/*!
+ \brief Refers to the contiguous sequence of objects of type T. This is the
+ subset of C++20 std::span with the dynamic extent.
+
+ <B>Usage</B>
+
+ \code{.cpp}
+    #include "fixed_point.hpp"
+
+    using Q = libq::Q<15, 8>;
+
+    std::vector<Q> x(1024u), y(1024u);
+    libq::batch::add<Q>(x, y, x);  // x[i] += y[i]
+ \endcode
+*/
+template<typename T>
+class span {
+    using this_class = span<T>;
+
+ public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr span()
+        : m_data(nullptr),
+          m_size(0u) {}
+
+    constexpr span(pointer const _data, std::size_t const _size)
+        : m_data(_data),
+          m_size(_size) {}
+
+    template<std::size_t N>
+    constexpr span(T (&_array)[N])  // NOLINT
+        : m_data(_array),
+          m_size(N) {}
+
+    template<typename U,
+             typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>  // NOLINT
+    span(std::vector<U>& _x)  // NOLINT
+        : m_data(_x.data()),
+          m_size(_x.size()) {}
+
+    template<typename U,
+             typename = typename std::enable_if<std::is_convertible<U const(*)[], T(*)[]>::value>::type>  // NOLINT
+    span(std::vector<U> const& _x)  // NOLINT
+        : m_data(_x.data()),
+          m_size(_x.size()) {}
+
+    template<typename U,
+             std::size_t N,
+             typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>  // NOLINT
+    span(std::array<U, N>& _x)  // NOLINT
+        : m_data(_x.data()),
+          m_size(N) {}
+
+    template<typename U,
+             std::size_t N,
+             typename = typename std::enable_if<std::is_convertible<U const(*)[], T(*)[]>::value>::type>  // NOLINT
+    span(std::array<U, N> const& _x)  // NOLINT
+        : m_data(_x.data()),
+          m_size(N) {}
+
+    template<typename U,
+             typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>  // NOLINT
+    constexpr span(span<U> const& _x)  // NOLINT
+        : m_data(_x.data()),
+          m_size(_x.size()) {}
+
+    constexpr pointer data() const {
+        return this->m_data;
+    }
+
+    constexpr std::size_t size() const {
+        return this->m_size;
+    }
+
+    constexpr bool empty() const {
+        return this->m_size == 0u;
+    }
+
+    constexpr reference operator [](std::size_t const _i) const {
+        return this->m_data[_i];
+    }
+
+    constexpr iterator begin() const {
+        return this->m_data;
+    }
+
+    constexpr iterator end() const {
+        return this->m_data + this->m_size;
+    }
+
+    /*!
+     \brief Gets the view of _count objects starting from _offset.
+    */
+    constexpr this_class subspan(std::size_t const _offset,
+                                 std::size_t const _count) const {
+        return this_class(this->m_data + _offset, _count);
+    }
+
+ private:
+    pointer m_data;
+    std::size_t m_size;
+};
+
+}  // namespace libq
+
+#endif  // INC_LIBQ_SPAN_HPP_
@@ -21,6 +21,47 @@
 namespace libq {
 namespace details {
 
+/*!
+ \brief Gets the narrowest built-in signed integer of the given bits (the sign
+ bit included). Unlike boost::int_t, this gets largest_signed_word for more
+ than 64 bits.
+*/
+template<std::size_t bits>
+class int_least {
+    enum: std::size_t {
+        max_bits = std::numeric_limits<std::intmax_t>::digits + 1u
+    };
+
+    static_assert(bits <= std::numeric_limits<largest_signed_word>::digits + 1u,  // NOLINT
+                  "no built-in integer has so many bits");
+
+ public:
+    using type = typename std::conditional<(bits <= max_bits),
+        typename boost::int_t<(bits <= max_bits) ? bits : max_bits>::least,
+        largest_signed_word>::type;
+};
+
+
+/*!
+ \brief Gets the narrowest built-in unsigned integer of the given bits. See
+ int_least.
+*/
+template<std::size_t bits>
+class uint_least {
+    enum: std::size_t {
+        max_bits = std::numeric_limits<std::uintmax_t>::digits
+    };
+
+    static_assert(bits <= std::numeric_limits<largest_unsigned_word>::digits,
+                  "no built-in integer has so many bits");
+
+ public:
+    using type = typename std::conditional<(bits <= max_bits),
+        typename boost::uint_t<(bits <= max_bits) ? bits : max_bits>::least,
+        largest_unsigned_word>::type;
+};
+
+
 /*!
  \brief
  \tparam T fixed-point type
@@ -39,8 +80,8 @@ class type_promotion_base<libq::fixed_point<T, _n, _f, _e, op, up>, delta_n, del
     using this_class = type_promotion_base<Q, delta_n, delta_f, delta_e>;
 
     using max_type = typename std::conditional<Q::is_signed,
-                                               std::intmax_t,
-                                               std::uintmax_t>::type;
+                                               largest_signed_word,
+                                               largest_unsigned_word>::type;
     enum: std::size_t {
         sign_bit = static_cast<std::size_t>(Q::is_signed),
 
@@ -53,10 +94,10 @@ class type_promotion_base<libq::fixed_point<T, _n, _f, _e, op, up>, delta_n, del
 
     // simple "type" wrapper for lazy instantiation of its "internal" type
     struct storage_type_promotion_traits {
-        // Note, boost::int_t takes a sign bit into account
+        // Note, int_least takes a sign bit into account
         using type = typename std::conditional<Q::is_signed,
-                                               typename boost::int_t<(n + delta_n) + (f + delta_f) + this_class::sign_bit>::least,  // NOLINT
-                                               typename boost::uint_t<(n + delta_n) + (f + delta_f)>::least>::type;  // NOLINT
+                                               typename int_least<(n + delta_n) + (f + delta_f) + this_class::sign_bit>::type,  // NOLINT
+                                               typename uint_least<(n + delta_n) + (f + delta_f)>::type>::type;  // NOLINT
     };
     struct storage_type_default_traits {
         using type = typename Q::storage_type;
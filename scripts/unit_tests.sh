@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# unit_tests.sh
+#
+# Copyright (c) 2016 Piotr K. Semenov (piotr.k.semenov at gmail dot com)
+# Distributed under the New BSD License. (See accompanying file LICENSE)
+#
+# Builds and runs the unit tests with GCC or Clang in two dialects: the GNU
+# one provides __int128 as the widest word, the strict one (no GNU
+# extensions, as MSVC) falls back to std::intmax_t. Boost.Test and Boost.Log
+# are required.
+#
+# Usage: scripts/unit_tests.sh [boost test arguments], e.g.
+#     CXX=clang++ scripts/unit_tests.sh --run_test='!Precision'
+
+set -e
+
+cd "$(dirname "$0")/.."
+CXX=${CXX:-g++}
+BUILD_DIR=${BUILD_DIR:-build/unit_tests}
+LIBS="-Wl,-Bstatic -lboost_unit_test_framework -Wl,-Bdynamic -lboost_log -lboost_log_setup -lboost_thread -lboost_system -lpthread"
+
+status=0
+for dialect in gnu++11 c++14; do
+    mkdir -p "$BUILD_DIR/$dialect"
+    objects=""
+    for source in tests/*.cpp; do
+        object="$BUILD_DIR/$dialect/$(basename "$source" .cpp).o"
+        $CXX -std=$dialect -O1 -DIMPLICIT_COPY_CTR -DBOOST_LOG_DYN_LINK -I. \
+            -c "$source" -o "$object"
+        objects="$objects $object"
+    done
+    $CXX $objects -o "$BUILD_DIR/$dialect/unit_tests" $LIBS
+
+    echo "unit tests (-std=$dialect):"
+    "$BUILD_DIR/$dialect/unit_tests" "$@" || status=1
+done
+
+exit $status
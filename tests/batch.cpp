@@ -0,0 +1,681 @@
+#define BOOST_TEST_STATIC_LINK
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "boost/test/unit_test.hpp"
+
+#include "libq/fixed_point.hpp"
+
+namespace libq {
+namespace unit_tests {
+
+BOOST_AUTO_TEST_SUITE(Batch)
+
+namespace {
+
+/// Gets _copies of the numbers of the whole range of format Q together with
+/// the range limits. If _is_quiet is set, the numbers are kept small, so the
+/// most of operations do not raise the overflow event.
+template<typename Q>
+std::vector<Q> samples(std::size_t const _size,
+                       std::size_t const _copies,
+                       unsigned const _seed,
+                       bool const _is_quiet) {
+    using storage_type = typename Q::storage_type;
+
+    std::mt19937_64 generator(_seed);
+    std::uniform_int_distribution<std::intmax_t> distribution(
+        _is_quiet ? -static_cast<std::intmax_t>(Q::scale) * Q::is_signed :
+                    Q::least_stored_integer,
+        _is_quiet ? static_cast<std::intmax_t>(Q::scale) :
+                    static_cast<std::intmax_t>(Q::largest_stored_integer));
+
+    std::vector<Q> result(_size);
+    for (Q& x : result) {
+        libq::lift(x) = static_cast<storage_type>(distribution(generator));
+    }
+    if (!_is_quiet) {
+        libq::lift(result[1]) =
+            static_cast<storage_type>(Q::least_stored_integer);
+        libq::lift(result[2]) =
+            static_cast<storage_type>(Q::largest_stored_integer);
+        libq::lift(result[3]) = 0;
+    }
+
+    // the samples are repeated, so the number of operations of each kind is
+    // a multiple of the sampling periods below
+    std::vector<Q> const copy(result);
+    for (std::size_t i = 1; i != _copies; ++i) {
+        result.insert(result.end(), copy.begin(), copy.end());
+    }
+
+    return result;
+}
+
+
+/// Gets the results of the batch/scalar loop together with the raised
+/// events, i.e. the exception message or the numbers of flagged events.
+template<typename Q>
+struct outcome {
+    std::vector<Q> values;
+    std::string exception;
+    libq::arithmetics_status status;
+};
+
+
+template<class Operation, typename Q, typename Loop>
+outcome<Q> run(std::vector<Q> const& _x,
+               std::vector<Q> const& _y,
+               Loop _loop) {
+    outcome<Q> result;
+    result.values.assign(_x.size(), Q(0));
+
+    libq::arithmetics_status::reset_this_thread();
+    try {
+        _loop(_x, _y, result.values);
+    } catch (std::exception const& _e) {
+        result.exception = _e.what();
+    }
+    result.status = libq::arithmetics_status::of_this_thread();
+
+    return result;
+}
+
+
+/// Checks if the batch operation gets the same results and events as the
+/// scalar loop does for every instruction set.
+template<class Operation, typename Q>
+void check_against_scalar(std::vector<Q> const& _x,
+                          std::vector<Q> const& _y) {
+    outcome<Q> const expected = run<Operation>(_x, _y,
+        [](std::vector<Q> const& _a, std::vector<Q> const& _b,
+           std::vector<Q>& _r) {
+            for (std::size_t i = 0; i != _r.size(); ++i) {
+                _r[i] = Operation::scalar(_a[i], _b[i]);
+            }
+        });
+
+    libq::batch::instruction_set const sets[] = {
+        libq::batch::instruction_set::generic,
+        libq::batch::instruction_set::sse4_1,
+        libq::batch::instruction_set::avx2,
+        libq::batch::instruction_set::avx512
+    };
+    for (libq::batch::instruction_set const set : sets) {
+        if (libq::batch::use_instruction_set(set) != set) {
+            continue;
+        }
+
+        outcome<Q> const actual = run<Operation>(_x, _y,
+            [](std::vector<Q> const& _a, std::vector<Q> const& _b,
+               std::vector<Q>& _r) {
+                Operation::template batch<Q>(_a, _b, _r);
+            });
+
+        std::size_t mismatches = 0u;
+        for (std::size_t i = 0; i != expected.values.size(); ++i) {
+            mismatches += (expected.values[i].value() !=
+                           actual.values[i].value());
+        }
+        BOOST_CHECK_MESSAGE(mismatches == 0u &&
+            expected.exception == actual.exception &&
+            expected.status.overflows() == actual.status.overflows() &&
+            expected.status.underflows() == actual.status.underflows(),
+            Operation::name() << " of " << typeid(Q).name() <<
+            " differs from the scalar loop for instruction set " <<
+            static_cast<unsigned>(set));
+    }
+    libq::batch::use_instruction_set(libq::batch::instruction_set::avx512);
+}
+
+
+struct add_operation {
+    static char const* name() { return "add"; }
+
+    template<typename Q>
+    static void batch(std::vector<Q> const& _x, std::vector<Q> const& _y,
+                      std::vector<Q>& _r) {
+        libq::batch::add<Q>(_x, _y, _r);
+    }
+
+    template<typename Q>
+    static Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x + _y);
+    }
+};
+
+struct sub_operation {
+    static char const* name() { return "sub"; }
+
+    template<typename Q>
+    static void batch(std::vector<Q> const& _x, std::vector<Q> const& _y,
+                      std::vector<Q>& _r) {
+        libq::batch::sub<Q>(_x, _y, _r);
+    }
+
+    template<typename Q>
+    static Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x - _y);
+    }
+};
+
+struct mul_operation {
+    static char const* name() { return "mul"; }
+
+    template<typename Q>
+    static void batch(std::vector<Q> const& _x, std::vector<Q> const& _y,
+                      std::vector<Q>& _r) {
+        libq::batch::mul<Q>(_x, _y, _r);
+    }
+
+    template<typename Q>
+    static Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x * _y);
+    }
+};
+
+struct div_operation {
+    static char const* name() { return "div"; }
+
+    template<typename Q>
+    static void batch(std::vector<Q> const& _x, std::vector<Q> const& _y,
+                      std::vector<Q>& _r) {
+        libq::batch::div<Q>(_x, _y, _r);
+    }
+
+    template<typename Q>
+    static Q scalar(Q const& _x, Q const& _y) {
+        return Q(_x / _y);
+    }
+};
+
+struct neg_operation {
+    static char const* name() { return "neg"; }
+
+    template<typename Q>
+    static void batch(std::vector<Q> const& _x, std::vector<Q> const&,
+                      std::vector<Q>& _r) {
+        libq::batch::neg<Q>(_x, _r);
+    }
+
+    template<typename Q>
+    static Q scalar(Q const& _x, Q const&) {
+        return -_x;
+    }
+};
+
+struct abs_operation {
+    static char const* name() { return "abs"; }
+
+    template<typename Q>
+    static void batch(std::vector<Q> const& _x, std::vector<Q> const&,
+                      std::vector<Q>& _r) {
+        libq::batch::abs<Q>(_x, _r);
+    }
+
+    template<typename Q>
+    static Q scalar(Q const& _x, Q const&) {
+        return std::fabs(_x);
+    }
+};
+
+
+template<typename Q>
+void check_format(unsigned const _seed) {
+    // the number of elements is not a multiple of the vector/block sizes
+    std::size_t const size = 250u;
+    std::size_t const copies = 4u;
+
+    for (bool const is_quiet : {true, false}) {
+        std::vector<Q> const x = samples<Q>(size, copies, _seed, is_quiet);
+        std::vector<Q> y = samples<Q>(size, copies, _seed + 1u, is_quiet);
+
+        check_against_scalar<add_operation>(x, y);
+        check_against_scalar<sub_operation>(x, y);
+        check_against_scalar<mul_operation>(x, y);
+        check_against_scalar<neg_operation>(x, y);
+        check_against_scalar<abs_operation>(x, y);
+
+        // the scalar division by zero is undefined unless the results
+        // saturate
+        if (!libq::details::is_saturation_policy<typename Q::overflow_policy>::value) {  // NOLINT
+            for (Q& divisor : y) {
+                if (divisor.value() == 0 || divisor.value() == -1) {
+                    libq::lift(divisor) = 1;
+                }
+            }
+        }
+        check_against_scalar<div_operation>(x, y);
+    }
+}
+
+
+template<std::size_t n, std::size_t f, int e, class op, class up>
+void check_signed_and_unsigned(unsigned const _seed) {
+    check_format<libq::Q<n, f, e, op, up> >(_seed);
+    check_format<libq::UQ<n, f, e, op, up> >(_seed);
+}
+
+
+template<class op, class up>
+void check_policies(unsigned const _seed) {
+    check_signed_and_unsigned<7, 5, 0, op, up>(_seed);
+    check_signed_and_unsigned<15, 8, 0, op, up>(_seed);
+    check_signed_and_unsigned<28, 13, 5, op, up>(_seed);
+    check_signed_and_unsigned<30, 20, 0, op, up>(_seed);
+    check_signed_and_unsigned<62, 30, 0, op, up>(_seed);
+}
+
+
+/// Checks if the reductions get the same results and events as the scalar
+/// loops summing within format Wide (i.e. exactly) and converting the sum to
+/// format Q once.
+template<typename Q, typename Wide>
+void check_reductions(std::vector<Q> const& _x, std::vector<Q> const& _y) {
+    using product_type = decltype(_x[0] * _y[0]);
+    static_assert(static_cast<std::size_t>(Wide::bits_for_fractional) ==
+                    product_type::bits_for_fractional,
+                  "sums of products are to be exact");
+
+    Wide sum(0), dot(0), sum_of_squares(0);
+    for (std::size_t i = 0; i != _x.size(); ++i) {
+        sum = Wide(sum + Wide(_x[i]));
+        dot = Wide(dot + Wide(_x[i] * _y[i]));
+        sum_of_squares = Wide(sum_of_squares + Wide(_x[i] * _x[i]));
+    }
+
+    outcome<Q> expected, actual;
+    libq::arithmetics_status::reset_this_thread();
+    expected.values = {Q(sum), Q(dot), Q(sum_of_squares)};
+    expected.status = libq::arithmetics_status::of_this_thread();
+
+    libq::arithmetics_status::reset_this_thread();
+    actual.values = {libq::sum<Q>(_x),
+                     libq::dot<Q>(_x, _y),
+                     libq::sum_of_squares<Q>(_x)};
+    actual.status = libq::arithmetics_status::of_this_thread();
+
+    // the scalar conversion raises the underflow event if the overflowed
+    // sum wraps around to zero
+    BOOST_CHECK_MESSAGE(
+        expected.values[0].value() == actual.values[0].value() &&
+        expected.values[1].value() == actual.values[1].value() &&
+        expected.values[2].value() == actual.values[2].value() &&
+        expected.status.overflows() == actual.status.overflows() &&
+        (expected.status.underflows() == actual.status.underflows() ||
+         expected.status.overflows() != 0u),
+        "reductions of " << typeid(Q).name() << " of " << _x.size() <<
+        " elements differ from the exact sums");
+}
+
+
+template<std::size_t n, std::size_t f, std::size_t n_wide, class op, class up>  // NOLINT
+void check_reductions_of(unsigned const _seed) {
+    using Q = libq::Q<n, f, 0, op, up>;
+    using Wide = libq::Q<n_wide, 2u * f, 0, op, up>;
+
+    for (bool const is_quiet : {true, false}) {
+        check_reductions<Q, Wide>(samples<Q>(250u, 4u, _seed, is_quiet),
+                                  samples<Q>(250u, 4u, _seed + 1u, is_quiet));  // NOLINT
+    }
+
+    // the blocks of the accumulators are full of the largest terms
+    std::vector<Q> const least(70000u, std::numeric_limits<Q>::min());
+    check_reductions<Q, Wide>(least, least);
+    check_reductions<Q, Wide>(std::vector<Q>(), std::vector<Q>());
+}
+
+
+/// Gets the floating-point numbers of type T up to _beyond times the range
+/// limits of format Q. Every fourth number is the halfway case.
+template<typename Q, typename T>
+std::vector<T> float_samples(std::size_t const _size,
+                             double const _beyond,
+                             unsigned const _seed) {
+    std::mt19937_64 generator(_seed);
+    std::uniform_real_distribution<double> distribution(
+        _beyond * static_cast<double>(std::numeric_limits<Q>::min()),
+        _beyond * static_cast<double>(std::numeric_limits<Q>::max()));
+
+    std::vector<T> result(_size);
+    for (std::size_t i = 0; i != _size; ++i) {
+        double const x = distribution(generator);
+        result[i] = static_cast<T>((i % 4u == 0u) ?
+            (std::floor(x * Q::scale) + 0.5) / Q::scale : x);
+    }
+    result[1] = T(0);
+    result[2] = static_cast<T>(-0.5 / Q::scale);
+
+    return result;
+}
+
+
+/// Checks if the batch conversion from the floating-point numbers of type T
+/// gets the same results and events as the scalar loop does for every
+/// instruction set.
+template<typename Q, typename T>
+void check_from_float(unsigned const _seed) {
+    // the scalar conversion of the numbers beyond the range of 64-bit
+    // integers is undefined
+    double const beyond =
+        (std::numeric_limits<typename Q::storage_type>::digits < 62) ? 1.5 : 1.0;  // NOLINT
+
+    for (double const limit : {0.25, beyond}) {
+        std::vector<T> const x = float_samples<Q, T>(1000u, limit, _seed);
+        auto const convert = [&x](bool const _is_batch) {
+            outcome<Q> result;
+            result.values.assign(x.size(), Q(0));
+
+            libq::arithmetics_status::reset_this_thread();
+            try {
+                if (_is_batch) {
+                    libq::batch::from_float<Q>(x, result.values);
+                } else {
+                    for (std::size_t i = 0; i != x.size(); ++i) {
+                        result.values[i] = Q(x[i]);
+                    }
+                }
+            } catch (std::exception const& _e) {
+                result.exception = _e.what();
+            }
+            result.status = libq::arithmetics_status::of_this_thread();
+
+            return result;
+        };
+
+        outcome<Q> const expected = convert(false);
+
+        libq::batch::instruction_set const sets[] = {
+            libq::batch::instruction_set::generic,
+            libq::batch::instruction_set::sse4_1,
+            libq::batch::instruction_set::avx2,
+            libq::batch::instruction_set::avx512
+        };
+        for (libq::batch::instruction_set const set : sets) {
+            if (libq::batch::use_instruction_set(set) != set) {
+                continue;
+            }
+
+            outcome<Q> const actual = convert(true);
+
+            std::size_t mismatches = 0u;
+            for (std::size_t i = 0; i != x.size(); ++i) {
+                mismatches += (expected.values[i].value() !=
+                               actual.values[i].value());
+            }
+            BOOST_CHECK_MESSAGE(mismatches == 0u &&
+                expected.exception == actual.exception &&
+                expected.status.overflows() == actual.status.overflows() &&
+                expected.status.underflows() == actual.status.underflows(),
+                "from_float of " << typeid(T).name() << " to " <<
+                typeid(Q).name() << " differs from the scalar loop for "
+                "instruction set " << static_cast<unsigned>(set));
+        }
+        libq::batch::use_instruction_set(libq::batch::instruction_set::avx512);
+    }
+}
+
+
+template<class op, class up>
+void check_from_float_of(unsigned const _seed) {
+    check_from_float<libq::Q<7, 5, 0, op, up>, float>(_seed);
+    check_from_float<libq::Q<15, 8, 0, op, up>, float>(_seed);
+    check_from_float<libq::UQ<15, 8, 0, op, up>, float>(_seed);
+    check_from_float<libq::Q<28, 13, 5, op, up>, float>(_seed);
+    check_from_float<libq::Q<30, 20, 0, op, up>, double>(_seed);
+    check_from_float<libq::UQ<31, 20, 0, op, up>, double>(_seed);
+    check_from_float<libq::Q<62, 30, 0, op, up>, double>(_seed);
+}
+
+
+
+/// Checks if the batch conversions to the floating-point numbers get the same
+/// results as the conversion operators do for every instruction set. The
+/// doubles are to be exact.
+template<typename Q>
+void check_to_float(unsigned const _seed) {
+    std::vector<Q> const x = samples<Q>(1000u, 1u, _seed, false);
+
+    std::vector<float> expected_floats(x.size());
+    std::vector<double> expected_doubles(x.size());
+    std::size_t inexact = 0u;
+    for (std::size_t i = 0; i != x.size(); ++i) {
+        expected_floats[i] = static_cast<float>(x[i]);
+        expected_doubles[i] = static_cast<double>(x[i]);
+        inexact += (expected_doubles[i] != std::ldexp(
+            static_cast<double>(x[i].value()),
+            -static_cast<int>(Q::bits_for_fractional) - Q::scaling_factor_exponent));  // NOLINT
+    }
+    BOOST_CHECK_MESSAGE(inexact == 0u,
+        "conversion of " << typeid(Q).name() << " to double is not exact");
+
+    libq::batch::instruction_set const sets[] = {
+        libq::batch::instruction_set::generic,
+        libq::batch::instruction_set::sse4_1,
+        libq::batch::instruction_set::avx2,
+        libq::batch::instruction_set::avx512
+    };
+    for (libq::batch::instruction_set const set : sets) {
+        if (libq::batch::use_instruction_set(set) != set) {
+            continue;
+        }
+
+        std::vector<float> floats(x.size());
+        std::vector<double> doubles(x.size());
+        libq::batch::to_float<Q>(x, floats);
+        libq::batch::to_double<Q>(x, doubles);
+
+        BOOST_CHECK_MESSAGE(floats == expected_floats &&
+                            doubles == expected_doubles,
+            "to_float/to_double of " << typeid(Q).name() <<
+            " differs from the scalar loop for instruction set " <<
+            static_cast<unsigned>(set));
+    }
+    libq::batch::use_instruction_set(libq::batch::instruction_set::avx512);
+}
+
+
+
+/// Checks if the batch conversion between the formats gets the same results
+/// and events as the scalar loop does for every instruction set.
+template<typename Qdst, typename Qsrc, class Rounding>
+void check_convert(unsigned const _seed) {
+    for (bool const is_quiet : {true, false}) {
+        std::vector<Qsrc> const x = samples<Qsrc>(250u, 4u, _seed, is_quiet);
+        auto const convert = [&x](bool const _is_batch) {
+            outcome<Qdst> result;
+            result.values.assign(x.size(), Qdst(0));
+
+            libq::arithmetics_status::reset_this_thread();
+            try {
+                if (_is_batch) {
+                    libq::batch::convert<Qdst, Qsrc, Rounding>(
+                        x, result.values);
+                } else {
+                    for (std::size_t i = 0; i != x.size(); ++i) {
+                        result.values[i] =
+                            Qdst::template convert_from<Rounding>(x[i]);
+                    }
+                }
+            } catch (std::exception const& _e) {
+                result.exception = _e.what();
+            }
+            result.status = libq::arithmetics_status::of_this_thread();
+
+            return result;
+        };
+
+        outcome<Qdst> const expected = convert(false);
+
+        libq::batch::instruction_set const sets[] = {
+            libq::batch::instruction_set::generic,
+            libq::batch::instruction_set::sse4_1,
+            libq::batch::instruction_set::avx2,
+            libq::batch::instruction_set::avx512
+        };
+        for (libq::batch::instruction_set const set : sets) {
+            if (libq::batch::use_instruction_set(set) != set) {
+                continue;
+            }
+
+            outcome<Qdst> const actual = convert(true);
+
+            std::size_t mismatches = 0u;
+            for (std::size_t i = 0; i != x.size(); ++i) {
+                mismatches += (expected.values[i].value() !=
+                               actual.values[i].value());
+            }
+            BOOST_CHECK_MESSAGE(mismatches == 0u &&
+                expected.exception == actual.exception &&
+                expected.status.overflows() == actual.status.overflows() &&
+                expected.status.underflows() == actual.status.underflows(),
+                "convert of " << typeid(Qsrc).name() << " to " <<
+                typeid(Qdst).name() << " differs from the scalar loop for "
+                "instruction set " << static_cast<unsigned>(set));
+        }
+        libq::batch::use_instruction_set(libq::batch::instruction_set::avx512);
+    }
+}
+
+
+template<class op, class up, class Rounding>
+void check_convert_of(unsigned const _seed) {
+    using libq::Q;
+    using libq::UQ;
+
+    check_convert<Q<15, 12, 0, op, up>, Q<31, 24, 0, op, up>, Rounding>(_seed);
+    check_convert<Q<7, 5, 0, op, up>, Q<15, 8, 0, op, up>, Rounding>(_seed);
+    check_convert<UQ<15, 8, 0, op, up>, Q<15, 12, 0, op, up>, Rounding>(_seed);
+    check_convert<Q<15, 8, 0, op, up>, UQ<23, 13, 3, op, up>, Rounding>(_seed);
+    check_convert<Q<30, 20, 0, op, up>, Q<15, 8, 0, op, up>, Rounding>(_seed);
+    check_convert<Q<30, 20, 0, op, up>, Q<62, 30, 0, op, up>, Rounding>(_seed);
+}
+
+
+template<class op, class up>
+void check_roundings_of(unsigned const _seed) {
+    check_convert_of<op, up, libq::truncation>(_seed);
+    check_convert_of<op, up, libq::round_half_up>(_seed);
+    check_convert_of<op, up, libq::round_half_even>(_seed);
+}
+
+}  // namespace
+
+
+/// test 'equal_to_scalar_loop':
+///     checks if the batch operations get the same results and raise the
+///     same events as the scalar loops do for every instruction set
+BOOST_AUTO_TEST_CASE(equal_to_scalar_loop)
+{
+    check_policies<libq::ignorance_policy, libq::ignorance_policy>(1u);
+    check_policies<libq::saturation_policy, libq::ignorance_policy>(2u);
+    check_policies<libq::overflow_flag_policy, libq::underflow_flag_policy>(3u);  // NOLINT
+    check_policies<libq::overflow_exception_policy,
+                   libq::underflow_exception_policy>(4u);
+    check_policies<libq::sampling_policy<libq::overflow_flag_policy, 4u>,
+                   libq::sampling_policy<libq::underflow_flag_policy, 4u> >(5u);  // NOLINT
+    check_policies<libq::overflow_flag_policy,
+                   libq::rounding_policy<libq::round_half_even,
+                                         libq::underflow_flag_policy> >(6u);
+    check_policies<libq::saturation_policy,
+                   libq::rounding_policy<libq::round_half_up> >(7u);
+}
+
+
+/// test 'spans_of_different_sizes':
+///     checks if the spans of different sizes are rejected
+BOOST_AUTO_TEST_CASE(spans_of_different_sizes)
+{
+    using Q = libq::Q<15, 8>;
+
+    std::vector<Q> x(8u), y(7u);
+    BOOST_CHECK_THROW(libq::batch::add<Q>(x, y, x), std::invalid_argument);
+    BOOST_CHECK_THROW(libq::batch::neg<Q>(x, y), std::invalid_argument);
+}
+
+
+/// test 'from_float_equal_to_scalar_loop':
+///     checks if the batch conversion from the floating-point numbers gets
+///     the same results and raises the same events as the scalar loop does
+BOOST_AUTO_TEST_CASE(from_float_equal_to_scalar_loop)
+{
+    check_from_float_of<libq::ignorance_policy, libq::ignorance_policy>(10u);
+    check_from_float_of<libq::saturation_policy, libq::ignorance_policy>(11u);
+    check_from_float_of<libq::overflow_flag_policy,
+                        libq::underflow_flag_policy>(12u);
+    check_from_float_of<libq::overflow_exception_policy,
+                        libq::underflow_exception_policy>(13u);
+    check_from_float_of<libq::sampling_policy<libq::overflow_flag_policy, 4u>,
+                        libq::sampling_policy<libq::underflow_flag_policy, 4u> >(14u);  // NOLINT
+}
+
+
+/// test 'to_float_equal_to_scalar_loop':
+///     checks if the batch conversions to the floating-point numbers get the
+///     same results as the conversion operators do
+BOOST_AUTO_TEST_CASE(to_float_equal_to_scalar_loop)
+{
+    using libq::Q;
+    using libq::UQ;
+
+    check_to_float<Q<7, 5> >(15u);
+    check_to_float<Q<15, 8> >(16u);
+    check_to_float<UQ<15, 8> >(17u);
+    check_to_float<Q<28, 13, 5> >(18u);
+    check_to_float<UQ<23, 13, 3> >(19u);
+    check_to_float<Q<24, 23, -20> >(20u);
+    check_to_float<UQ<31, 20> >(21u);
+    check_to_float<Q<52, 52, -2> >(22u);
+}
+
+
+/// test 'convert_equal_to_scalar_loop':
+///     checks if the batch conversions between the fixed-point formats get
+///     the same results and raise the same events as the scalar loop does
+BOOST_AUTO_TEST_CASE(convert_equal_to_scalar_loop)
+{
+    check_roundings_of<libq::ignorance_policy, libq::ignorance_policy>(23u);
+    check_roundings_of<libq::saturation_policy, libq::ignorance_policy>(24u);
+    check_roundings_of<libq::overflow_flag_policy,
+                       libq::underflow_flag_policy>(25u);
+    check_roundings_of<libq::overflow_exception_policy,
+                       libq::underflow_exception_policy>(26u);
+    check_roundings_of<libq::sampling_policy<libq::overflow_flag_policy, 4u>,
+                       libq::sampling_policy<libq::underflow_flag_policy, 4u> >(27u);  // NOLINT
+}
+
+
+/// test 'reductions_equal_to_exact_sums':
+///     checks if the sums and the dot products are rounded and checked once
+BOOST_AUTO_TEST_CASE(reductions_equal_to_exact_sums)
+{
+    using flagged = libq::overflow_flag_policy;
+    using underflow_flagged = libq::underflow_flag_policy;
+    using saturated = libq::saturation_policy;
+    using ignored = libq::ignorance_policy;
+
+    check_reductions_of<7, 5, 40, flagged, underflow_flagged>(6u);
+    check_reductions_of<15, 8, 50, flagged, underflow_flagged>(7u);
+    check_reductions_of<15, 8, 50, saturated, ignored>(8u);
+    check_reductions_of<20, 12, 60, ignored, ignored>(9u);
+
+#if defined(LIBQ_HAS_INT128)
+    // the sum of products takes 72 bits
+    using Q = libq::Q<31, 29>;
+    using Q_wide = libq::Q<50, 29>;
+    std::vector<Q> const x(1000u, Q(1.5));
+    BOOST_CHECK_MESSAGE((libq::sum_of_squares<Q, Q_wide>(x) == 2250.0),
+                        "sum of products beyond 64 bits is not exact");
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace unit_tests
+}  // namespace libq
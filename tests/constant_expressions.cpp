@@ -0,0 +1,88 @@
+#define BOOST_TEST_STATIC_LINK
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <typeinfo>
+
+#include "boost/test/unit_test.hpp"
+
+#include "libq/fixed_point.hpp"
+
+namespace libq {
+namespace unit_tests {
+
+BOOST_AUTO_TEST_SUITE(Constant_expressions)
+
+/// test 'arithmetics_at_compile_time':
+///     checks if the fixed-point arithmetics and the named constants are
+///     evaluated within the constant expressions
+BOOST_AUTO_TEST_CASE(arithmetics_at_compile_time)
+{
+    using Q = libq::Q<30, 20>;
+
+    constexpr Q a(1.5);
+    constexpr Q b(-2.25);
+
+    static_assert((a + b) == -0.75, "addition is not evaluated properly");
+    static_assert((a - b) == 3.75, "subtraction is not evaluated properly");
+    static_assert((a * b) == -3.375,
+                  "multiplication is not evaluated properly");
+    static_assert((b / a) == -1.5, "division is not evaluated properly");
+    static_assert(-a == -1.5 && !Q(0), "negation is not evaluated properly");
+    static_assert(libq::Q<20, 8>(a) == 1.5,
+                  "conversion is not evaluated properly");
+    static_assert(Q(-3) == -3.0 && Q(-3).value() == -(3 << 20),
+                  "integer is not converted properly");
+
+    static_assert(Q::CONST_PI > 3.14159 && Q::CONST_PI < 3.1416,
+                  "pi is not folded");
+    static_assert(Q::CONST_2PI > Q::CONST_PI + Q::CONST_PI_2,
+                  "constants are not folded");
+    static_assert(std::numeric_limits<Q>::max() > 0 &&
+                  std::numeric_limits<Q>::min() < 0,
+                  "range is not evaluated properly");
+
+    BOOST_CHECK(Q::CONST_PI.value() == 3294199);
+}
+
+
+/// Checks if the angles of the look-up tables of format Q generated at
+/// compile time are within 1 ulp of ones computed by the standard library.
+template<typename Q>
+void check_angles_of_lut() {
+    using lut_type = libq::cordic::lut<Q::bits_for_fractional, Q>;
+
+    constexpr lut_type circular = lut_type::circular();
+    constexpr lut_type hyperbolic =
+        lut_type::hyperbolic_wo_repeated_iterations();
+    double const ulp =
+        std::ldexp(1.0, -static_cast<int>(Q::bits_for_fractional));
+
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0; i != lut_type::dim; ++i) {
+        double const x = std::ldexp(1.0, -static_cast<int>(i));
+
+        mismatches +=
+            std::fabs(static_cast<double>(circular[i]) - std::atan(x)) > ulp;
+        mismatches +=
+            std::fabs(static_cast<double>(hyperbolic[i]) - std::atanh(x / 2.0)) > ulp;  // NOLINT
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+        "angles of " << typeid(Q).name() << " are not within 1 ulp");
+}
+
+
+/// test 'look_up_tables_at_compile_time':
+///     checks if the angles of CORDIC rotations are generated at compile time
+///     as precisely as the work formats allow
+BOOST_AUTO_TEST_CASE(look_up_tables_at_compile_time)
+{
+    check_angles_of_lut<libq::Q<18, 16> >();
+    check_angles_of_lut<libq::Q<34, 32> >();
+    check_angles_of_lut<libq::Q<54, 52> >();
+}
+BOOST_AUTO_TEST_SUITE_END()
+
+} // unit_tests
+} // libq
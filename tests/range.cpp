@@ -1,8 +1,15 @@
 #define BOOST_TEST_STATIC_LINK
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <string>
 #include <limits>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 #include "boost/test/unit_test.hpp"
 
@@ -69,6 +76,781 @@ BOOST_AUTO_TEST_CASE(out_of_range_policies)
     }
     catch (std::overflow_error e) {}
 }
+
+/// test 'saturation_policy':
+///     checks if the out-of-range results are clamped to the range of format
+BOOST_AUTO_TEST_CASE(saturation_policy)
+{
+    using Q = libq::Q<15, 8, 0, libq::saturation_policy>;
+    using UQ = libq::UQ<8, 5, 0, libq::saturation_policy>;
+
+    Q const max = std::numeric_limits<Q>::max();
+    Q const min = std::numeric_limits<Q>::min();
+
+    BOOST_CHECK_MESSAGE(Q(1000.0) == max && Q(-1000.0) == min,
+                        "floating-point number is not saturated");
+    BOOST_CHECK_MESSAGE(Q(1000) == max && Q(-1000) == min,
+                        "integer is not saturated");
+    BOOST_CHECK_MESSAGE(UQ(-1.0) == 0 && UQ(300) == std::numeric_limits<UQ>::max(),  // NOLINT
+                        "unsigned format is not saturated");
+
+    BOOST_CHECK_MESSAGE(Q(max + max) == max && Q(min + min) == min,
+                        "sum is not saturated");
+    BOOST_CHECK_MESSAGE(Q(min - max) == min && Q(max - min) == max,
+                        "difference is not saturated");
+    BOOST_CHECK_MESSAGE(Q(max * min) == min && Q(min * min) == max,
+                        "product is not saturated");
+    BOOST_CHECK_MESSAGE(Q(max / Q::wrap(1)) == max &&
+                        Q(min / Q::wrap(1)) == min,
+                        "quotient is not saturated");
+    BOOST_CHECK_MESSAGE(-min == max, "negation is not saturated");
+
+    Q x(100.0);
+    x *= x;
+    BOOST_CHECK_MESSAGE(x == max, "assignment is not saturated");
+
+    Q const y(1.5);
+    BOOST_CHECK_MESSAGE(Q(y + y) == 3.0 && Q(y * y) == 2.25 && y / y == 1.0,
+                        "in-range results must not be changed");
+}
+
+/// test 'flag_policies':
+///     checks if the overflow/underflow events are counted per thread and
+///     in aggregate instead of throwing
+BOOST_AUTO_TEST_CASE(flag_policies)
+{
+    using Q = libq::Q<15, 8, 0,
+                      libq::overflow_flag_policy,
+                      libq::underflow_flag_policy>;
+
+    libq::arithmetics_status::reset_all_threads();
+
+    Q const max = std::numeric_limits<Q>::max();
+    Q const tiny = Q::wrap(1);
+    Q x = Q(max + max);
+    x = -std::numeric_limits<Q>::min();
+    x = Q(tiny * tiny);
+
+    libq::arithmetics_status const status =
+        libq::arithmetics_status::of_this_thread();
+    BOOST_CHECK_MESSAGE(status.overflows() == 2u && status.underflows() == 1u,
+                        "events are not counted");
+    BOOST_CHECK_MESSAGE(status.flags() == (libq::arithmetics_status::overflow_flag |  // NOLINT
+                                           libq::arithmetics_status::underflow_flag),  // NOLINT
+                        "sticky flags are not raised");
+
+    std::thread worker([max]() {
+        Q const y = Q(max + max);
+    });
+    worker.join();
+
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().overflows() == 2u,  // NOLINT
+                        "events of other threads are counted");
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_all_threads().overflows() == 3u,  // NOLINT
+                        "events of exited threads are lost");
+
+    libq::arithmetics_status::reset_this_thread();
+    BOOST_CHECK_MESSAGE(!libq::arithmetics_status::of_this_thread(),
+                        "status is not reset");
+    libq::arithmetics_status::reset_all_threads();
+    BOOST_CHECK_MESSAGE(!libq::arithmetics_status::of_all_threads(),
+                        "aggregated status is not reset");
+
+    // the zero divisor saturates the quotient instead of trapping
+    using quotient_type = decltype(Q() / Q());
+    Q const zero(0.0);
+    libq::divider<Q> const by_zero(zero);
+    BOOST_CHECK_MESSAGE(max / zero == std::numeric_limits<quotient_type>::max() &&  // NOLINT
+                        -max / zero == std::numeric_limits<quotient_type>::min() &&  // NOLINT
+                        max / by_zero == std::numeric_limits<quotient_type>::max(),  // NOLINT
+                        "division by zero is not saturated");
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().overflows() == 3u,  // NOLINT
+                        "division by zero is not counted");
+}
+
+/// test 'sampled_checks':
+///     checks if the overflow events are detected for 1 in N operations only
+BOOST_AUTO_TEST_CASE(sampled_checks)
+{
+    using Q = libq::Q<15, 8, 0,
+                      libq::sampling_policy<libq::overflow_flag_policy, 4u> >;
+
+    libq::arithmetics_status::reset_this_thread();
+
+    Q const min = std::numeric_limits<Q>::min();
+    for (std::size_t i = 0; i != 8u; ++i) {
+        Q const x = -min;
+    }
+
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().overflows() == 2u,  // NOLINT
+                        "overflows are not sampled");
+}
+
+namespace {
+
+/// Checks if the sums and the differences of the numbers of formats Q1 and Q2
+/// are equal to ones of the operands converted to the common format first.
+template<typename Q1, typename Q2>
+std::size_t inexact_mixed_sums() {
+    using sum_type = decltype(Q1() + Q2());
+    using diff_type = decltype(Q1() - Q2());
+
+    std::size_t mismatches = 0u;
+    std::intmax_t const least1 = Q1::least_stored_integer;
+    std::intmax_t const largest1 = Q1::largest_stored_integer;
+    std::intmax_t const least2 = Q2::least_stored_integer;
+    std::intmax_t const largest2 = Q2::largest_stored_integer;
+
+    for (std::intmax_t i : {least1, least1 / 3, std::intmax_t(5), largest1 / 3, largest1}) {  // NOLINT
+        for (std::intmax_t j : {least2, least2 / 7, std::intmax_t(1), largest2 / 7, largest2}) {  // NOLINT
+            Q1 x;
+            Q2 y;
+            libq::lift(x) = static_cast<typename Q1::storage_type>(i);
+            libq::lift(y) = static_cast<typename Q2::storage_type>(j);
+
+            mismatches += (x + y).value() != sum_type(x).value() + sum_type(y).value();  // NOLINT
+            mismatches += (x - y).value() != diff_type(x).value() - diff_type(y).value();  // NOLINT
+        }
+    }
+
+    return mismatches;
+}
+
+}  // namespace
+
+
+/// test 'mixed_format_sums':
+///     checks if the numbers of different formats are added and subtracted
+///     exactly within their common format without any event
+BOOST_AUTO_TEST_CASE(mixed_format_sums)
+{
+    using op = libq::overflow_exception_policy;
+    using up = libq::underflow_exception_policy;
+    using Q1 = libq::Q<15, 8, 0, op, up>;
+    using Q2 = libq::Q<15, 12, 0, op, up>;
+    using U1 = libq::UQ<16, 10, 0, op, up>;
+    using U2 = libq::UQ<20, 4, 0, op, up>;
+    using E = libq::Q<24, 23, -20, op, up>;
+
+    static_assert(std::is_same<decltype(Q1() + Q2()), libq::Q<20, 12, 0, op, up> >::value &&  // NOLINT
+                  std::is_same<decltype(U1() + U2()), libq::UQ<27, 10, 0, op, up> >::value &&  // NOLINT
+                  std::is_same<decltype(U1() - U2()), libq::Q<27, 10, 0, op, up> >::value,  // NOLINT
+                  "common format is not the narrowest exact one");
+
+    // the events of the common format would throw
+    std::size_t mismatches = 0u;
+    mismatches += inexact_mixed_sums<Q1, Q2>();
+    mismatches += inexact_mixed_sums<Q2, Q1>();
+    mismatches += inexact_mixed_sums<U1, U2>();
+    mismatches += inexact_mixed_sums<Q1, U1>();
+    mismatches += inexact_mixed_sums<Q1, E>();
+    mismatches += inexact_mixed_sums<E, U2>();
+
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "sum of different formats is inexact");
+}
+
+
+/// test 'mixed_format_compound_sums':
+///     checks if the numbers of different formats are added in place by the
+///     exact sum, so the range of the result is checked once
+BOOST_AUTO_TEST_CASE(mixed_format_compound_sums)
+{
+    using Q = libq::Q<9, 3, 0,
+                      libq::overflow_flag_policy,
+                      libq::underflow_flag_policy>;
+    using Q_fine = libq::Q<15, 8>;
+
+    libq::arithmetics_status::reset_this_thread();
+
+    Q x(1.5);
+    x += Q_fine(2.25);
+    x -= Q_fine(0.125);
+    BOOST_CHECK_MESSAGE(x == 3.625 && !libq::arithmetics_status::of_this_thread(),  // NOLINT
+                        "sum of different formats is not assigned");
+
+    x += Q_fine(100.0);
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().overflows() == 1u,  // NOLINT
+                        "overflow of the sum is not reported once");
+
+    x = Q(0.0);
+    x += Q_fine(0.0625);
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().underflows() == 1u,  // NOLINT
+                        "underflow of the sum is not reported");
+}
+
+
+/// test 'comparisons':
+///     checks if the numbers are compared with the out-of-range literals
+///     without any event, and with the numbers of other formats exactly
+BOOST_AUTO_TEST_CASE(comparisons)
+{
+    using op = libq::overflow_exception_policy;
+    using up = libq::underflow_exception_policy;
+    using Q1 = libq::Q<15, 8, 0, op, up>;
+    using Q2 = libq::Q<15, 12, 0, op, up>;
+    using U1 = libq::UQ<16, 10, 0, op, up>;
+    using Q_saturated = libq::Q<7, 3, 0, libq::saturation_policy>;
+
+    // the conversions of the literals would throw or saturate
+    BOOST_CHECK_MESSAGE(Q1(1.0) < 1000.0 && Q1(1.0) > -1000.0 &&
+                        Q1(1.0) != 1.0e6 && Q1(1.0) <= 1000 &&
+                        U1(1.0) > -1 && U1(1.0) >= -1.0e-3,
+                        "out-of-range number is compared wrongly");
+    BOOST_CHECK_MESSAGE(Q_saturated(15.0) < 16.0 &&
+                        Q_saturated(-16.0) > -17 &&
+                        Q_saturated(15.0) != 1000.0,
+                        "saturated number equals to out-of-range one");
+
+    // the in-range numbers are rounded to the nearest stored integers
+    BOOST_CHECK_MESSAGE(Q1(0.1) == 0.1 && Q1(0.1) == 0.1f &&
+                        Q1(-3.0) == -3 && Q1(0.5) > 0.49 && Q1(0.5) < 0.51,
+                        "in-range number is compared wrongly");
+
+    // the finer bits are not truncated
+    Q1 const x(1.0);
+    Q2 const y(1.0 + std::ldexp(1.0, -12));
+    BOOST_CHECK_MESSAGE(x < y && x != y && y > x && !(x == y) &&
+                        x == Q2(1.0) && Q2(1.0) == x,
+                        "numbers of different formats are compared inexactly");  // NOLINT
+    BOOST_CHECK_MESSAGE(Q1(-1.0) < U1(3.0) && U1(3.0) > Q1(-1.0) &&
+                        U1(50.0) > Q2(7.0),
+                        "signed and unsigned numbers are compared wrongly");
+}
+
+
+/// test 'pre_scaled_formats':
+///     checks if the numbers of the pre-scaled formats keep their values
+///     through the conversions from/to the floating-point numbers and the
+///     other formats
+BOOST_AUTO_TEST_CASE(pre_scaled_formats)
+{
+    using Q = libq::Q<20, 10>;
+    using Q_up = libq::Q<20, 10, 2>;
+    using Q_down = libq::Q<20, 10, -3>;
+
+    BOOST_CHECK_MESSAGE(static_cast<double>(Q_up(1.0)) == 1.0 &&
+                        static_cast<double>(Q_down(-1.5)) == -1.5 &&
+                        static_cast<double>(Q_up(3)) == 3.0,
+                        "pre-scaled number is converted wrongly");
+    BOOST_CHECK_MESSAGE(static_cast<double>(Q(Q_up(1.0))) == 1.0 &&
+                        static_cast<double>(Q_up(Q(1.0))) == 1.0 &&
+                        static_cast<double>(Q_down(Q_up(-0.25))) == -0.25 &&
+                        Q_up(0.75) == Q_down(0.75),
+                        "numbers of pre-scaled formats are converted wrongly");  // NOLINT
+}
+
+
+/// test 'fused_multiply_add':
+///     checks if a * b + c is checked once for the overflow of the result
+///     rather than for the overflow of the product
+BOOST_AUTO_TEST_CASE(fused_multiply_add)
+{
+    using Q = libq::Q<7, 3, 0,
+                      libq::overflow_flag_policy,
+                      libq::underflow_flag_policy>;
+    using Q_wide = libq::Q<30, 20, 0,
+                           libq::overflow_flag_policy,
+                           libq::underflow_flag_policy>;
+    using Q_saturated = libq::Q<7, 3, 0, libq::saturation_policy>;
+
+    libq::arithmetics_status::reset_this_thread();
+
+    BOOST_CHECK_MESSAGE(std::fma(Q(4.0), Q(5.0), Q(-10.0)) == 10.0,
+                        "in-range sum of out-of-range product is lost");
+    BOOST_CHECK_MESSAGE(std::fma(Q(1.5), Q(-2.25), Q(0.5)) == -2.875,
+                        "sum is not exact");
+    BOOST_CHECK_MESSAGE(libq::fma(Q(1.5), Q(-2.25), Q_wide(0.5)) ==
+                            Q_wide(-2.875) &&
+                        libq::fma(Q(3.5), Q_wide(0.125), Q(1.0)) == 1.375,
+                        "sum of mixed formats is not exact");
+    BOOST_CHECK_MESSAGE(!libq::arithmetics_status::of_this_thread(),
+                        "in-range sum raises events");
+
+    Q const max = std::numeric_limits<Q>::max();
+    Q const tiny = Q::wrap(1);
+    std::fma(max, max, max);
+    std::fma(tiny, tiny, Q(0.0));
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().overflows() == 1u &&  // NOLINT
+                        libq::arithmetics_status::of_this_thread().underflows() == 1u,  // NOLINT
+                        "events are not raised once");
+
+    Q_saturated const saturated_max = std::numeric_limits<Q_saturated>::max();
+    BOOST_CHECK_MESSAGE(std::fma(saturated_max, saturated_max, saturated_max) ==  // NOLINT
+                            saturated_max &&
+                        std::fma(saturated_max, -saturated_max, -saturated_max) ==  // NOLINT
+                            std::numeric_limits<Q_saturated>::min(),
+                        "sum is not saturated");
+}
+
+/// test 'accumulator':
+///     checks if the accumulator of N numbers has the guard bits for their
+///     sum and the narrowest storage
+BOOST_AUTO_TEST_CASE(accumulator)
+{
+    using Q = libq::Q<15, 8, 0,
+                      libq::overflow_flag_policy,
+                      libq::underflow_flag_policy>;
+    using acc_type = libq::accumulator<Q, 65536u>;
+
+    BOOST_CHECK_MESSAGE((std::is_same<acc_type::storage_type, std::int32_t>::value &&  // NOLINT
+                         std::is_same<libq::accumulator<Q, 65537u>::storage_type, std::int64_t>::value),  // NOLINT
+                        "accumulator does not keep the narrowest word");
+    BOOST_CHECK_MESSAGE((std::is_same<libq::accumulator<Q, 1u>, Q>::value &&
+                         std::is_same<libq::accumulator<double, 8u>, double>::value),  // NOLINT
+                        "accumulator adds the needless guard bits");
+
+    libq::arithmetics_status::reset_this_thread();
+
+    acc_type least(0), largest(0);
+    for (std::size_t i = 0; i != 65536u; ++i) {
+        least += std::numeric_limits<Q>::min();
+        largest += std::numeric_limits<Q>::max();
+    }
+
+    BOOST_CHECK_MESSAGE(least == -128.0 * 65536 &&
+                        largest == static_cast<double>(std::numeric_limits<Q>::max()) * 65536 &&  // NOLINT
+                        !libq::arithmetics_status::of_this_thread(),
+                        "sum of N numbers overflows the accumulator");
+}
+
+
+/// test 'rounding_modes':
+///     checks if the conversions dropping the fractional bits round them to
+///     minus infinity, to nearest (halfway up) and to nearest (halfway even)
+BOOST_AUTO_TEST_CASE(rounding_modes)
+{
+    using Q = libq::Q<15, 8>;
+    using Q_narrow = libq::Q<7, 2>;
+
+    std::size_t mismatches = 0u;
+    for (int k = -512; k <= 512; ++k) {
+        Q const x(k / 64.0);
+        double const scaled = k / 16.0;
+
+        mismatches +=
+            Q_narrow::convert_from<libq::truncation>(x) != std::floor(scaled) / 4.0;  // NOLINT
+        mismatches +=
+            Q_narrow::convert_from<libq::round_half_up>(x) != std::floor(scaled + 0.5) / 4.0;  // NOLINT
+        mismatches +=
+            Q_narrow::convert_from<libq::round_half_even>(x) != std::nearbyint(scaled) / 4.0;  // NOLINT
+    }
+
+    // all the digits of the signed word are dropped
+    using word_type = std::int32_t;
+    word_type const digits = std::numeric_limits<word_type>::digits;
+    mismatches += libq::round_half_even::shift_right<word_type>(std::numeric_limits<word_type>::max(), digits) != 1;  // NOLINT
+    mismatches += libq::round_half_even::shift_right<word_type>(std::numeric_limits<word_type>::min(), digits) != -1;  // NOLINT
+    mismatches += libq::round_half_even::shift_right<word_type>(word_type(1) << (digits - 1), digits) != 0;  // NOLINT
+
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "conversion rounds the dropped bits wrongly");
+}
+
+
+/// test 'rounding_policy':
+///     checks if the format rounds the conversions, the quotients and the
+///     CORDIC rotations by its rounding mode and reports the underflows
+///     through the wrapped policy
+BOOST_AUTO_TEST_CASE(rounding_policy)
+{
+    using Q_wide = libq::Q<15, 8>;
+    using Q = libq::Q<7, 2, 0,
+                      libq::ignorance_policy,
+                      libq::rounding_policy<libq::round_half_even,
+                                            libq::underflow_flag_policy> >;
+    using quotient_type = decltype(Q() / Q());
+
+    libq::arithmetics_status::reset_this_thread();
+
+    std::size_t mismatches = 0u;
+    for (int k = -512; k <= 512; ++k) {
+        mismatches += Q(Q_wide(k / 64.0)) != std::nearbyint(k / 16.0) / 4.0;
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "conversion ignores the rounding policy");
+    BOOST_CHECK_MESSAGE(libq::arithmetics_status::of_this_thread().underflows() > 0u,  // NOLINT
+                        "underflows are not reported by the wrapped policy");
+
+    double const scale = std::ldexp(1.0, quotient_type::bits_for_fractional);
+    for (int i = -32; i != 32; ++i) {
+        for (int j = -32; j != 32; ++j) {
+            if (j == 0 || (i == -32 && j == -1)) {
+                continue;
+            }
+            Q const x = Q::wrap(i), y = Q::wrap(j);
+            double const expected = std::nearbyint(double(i) / j * scale);
+            mismatches += static_cast<double>((x / y).value()) != expected;
+        }
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "quotient ignores the rounding policy");
+
+    // the product dropping its fractional bits is rounded by the addend format
+    using Q_fma = libq::Q<15, 4, 0,
+                          libq::ignorance_policy,
+                          libq::rounding_policy<libq::round_half_up> >;
+    using Q_factor = libq::Q<15, 8, 0,
+                             libq::ignorance_policy,
+                             libq::rounding_policy<libq::round_half_up> >;
+    for (int i = -64; i != 64; ++i) {
+        for (int j = -64; j != 64; ++j) {
+            Q_factor const a = Q_factor::wrap(i * 37), b = Q_factor::wrap(j * 11);  // NOLINT
+            mismatches += libq::fma(a, b, Q_fma(0.0)) != Q_fma(a * b);
+        }
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "fma ignores the rounding policy");
+
+    using Q_sin = libq::Q<15, 12, 0,
+                          libq::ignorance_policy,
+                          libq::rounding_policy<libq::round_half_even> >;
+    BOOST_CHECK_CLOSE(static_cast<double>(std::sin(Q_sin(0.5))),
+                      std::sin(0.5),
+                      0.1);
+}
+
+
+/// test 'stochastic_rounding':
+///     checks if the stochastic rounding has no bias and its sequence is
+///     reproducible
+BOOST_AUTO_TEST_CASE(stochastic_rounding)
+{
+    using Q_wide = libq::Q<15, 8>;
+    using Q = libq::Q<7, 2, 0,
+                      libq::ignorance_policy,
+                      libq::rounding_policy<libq::stochastic_rounding> >;
+
+    // 0.1015625 is 0.40625 of the least significant bit of Q
+    Q_wide const x = Q_wide::wrap(26);
+
+    libq::stochastic_rounding::seed(1u);
+    double sum = 0.0;
+    std::vector<Q> first;
+    for (std::size_t i = 0; i != 4096u; ++i) {
+        first.push_back(Q(x));
+        sum += static_cast<double>(first.back());
+    }
+    BOOST_CHECK_CLOSE(sum / 4096.0, static_cast<double>(x), 5.0);
+
+    libq::stochastic_rounding::seed(1u);
+    std::size_t mismatches = 0u;
+    for (Q const& y : first) {
+        mismatches += Q(x) != y;
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "stochastic rounding is not reproducible");
+}
+#if defined(LIBQ_HAS_INT128)
+/// test 'wide_formats':
+///     checks if the stored integers of more than 64 bits are of __int128 and
+///     the products and the quotients of the 64-bit ones are exact
+BOOST_AUTO_TEST_CASE(wide_formats)
+{
+    using Q = libq::Q<61, 52, 0, libq::overflow_exception_policy>;
+    using Q_wide = libq::Q<100, 90, 0, libq::overflow_exception_policy>;
+    using product_type = decltype(Q() * Q());
+
+    static_assert(std::is_same<product_type::storage_type, __int128>::value &&  // NOLINT
+                  product_type::bits_for_fractional == 104u,
+                  "product of 64-bit stored integers is not exact");
+    static_assert(std::is_same<Q_wide::storage_type, __int128>::value,
+                  "101-bit stored integers are not of __int128");
+
+    // (1 + 2^-52)^2 = 1 + 2^-51 + 2^-104
+    Q const x = Q::wrap((std::int64_t(1) << 52) + 1);
+    BOOST_CHECK_MESSAGE((x * x).value() ==
+                            (__int128(1) << 104) + (__int128(1) << 53) + 1,
+                        "product is not exact");
+    BOOST_CHECK_MESSAGE(-x * x == -(x * x) && x * -x == -(x * x),
+                        "product of negative numbers is not exact");
+
+    BOOST_CHECK_NO_THROW(Q(Q(3.0) / Q(2.0)));
+    BOOST_CHECK_MESSAGE(Q(Q(3.0) / Q(2.0)) == 1.5 &&
+                        Q(Q(1.0) / Q(3.0)) == Q::wrap((std::int64_t(1) << 52) / 3),  // NOLINT
+                        "quotient is not exact");
+
+    BOOST_CHECK_MESSAGE(Q_wide(-1.25) + Q_wide(4.0) == 2.75 &&
+                        Q_wide::largest().value() == (__int128(1) << 100) - 1 &&  // NOLINT
+                        Q_wide::least().value() == -(__int128(1) << 100),
+                        "128-bit stored integers are out of the range");
+    BOOST_CHECK_THROW(Q_wide(Q_wide::largest() + Q_wide::wrap(1)),
+                      std::overflow_error);
+}
+#endif
+
+
+namespace {
+
+/// Checks if the divider gets the same quotients and raises the same number
+/// of overflow events as operator/ does. The dividends run through the range
+/// of format Q with the given stride.
+template<typename Q>
+void check_divider(std::intmax_t const _divisor, std::intmax_t const _stride) {
+    using storage_type = typename Q::storage_type;
+
+    Q divisor;
+    libq::lift(divisor) = static_cast<storage_type>(_divisor);
+    libq::divider<Q> const divider(divisor);
+
+    std::size_t mismatches = 0u;
+    std::intmax_t const least = Q::least_stored_integer;
+    std::intmax_t const largest =
+        static_cast<std::intmax_t>(Q::largest_stored_integer);
+    for (std::intmax_t x = least; x <= largest;
+         x = (x < largest && x + _stride > largest) ? largest : x + _stride) {
+        Q dividend;
+        libq::lift(dividend) = static_cast<storage_type>(x);
+
+        libq::arithmetics_status::reset_this_thread();
+        auto const expected = dividend / divisor;
+        std::uintmax_t const overflows =
+            libq::arithmetics_status::of_this_thread().overflows();
+
+        libq::arithmetics_status::reset_this_thread();
+        auto const actual = dividend / divider;
+        mismatches += (expected.value() != actual.value() ||
+            overflows != libq::arithmetics_status::of_this_thread().overflows());  // NOLINT
+
+        if (x == largest) {
+            break;
+        }
+    }
+
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        mismatches << " quotients of " << typeid(Q).name() <<
+                        " by " << _divisor << " differ from operator/");
+}
+
+}  // namespace
+
+
+/// test 'invariant_divider':
+///     checks if the multiply-shift reciprocal of the divisor gets the same
+///     quotients and events as operator/ does
+BOOST_AUTO_TEST_CASE(invariant_divider)
+{
+    using flagged = libq::overflow_flag_policy;
+    using Q = libq::Q<15, 8, 0, flagged>;
+    using UQ = libq::UQ<16, 8, 0, flagged>;
+    using Q_saturated = libq::Q<15, 8, 0, libq::saturation_policy>;
+    using Q_wide = libq::Q<30, 20, 0, flagged>;
+    using UQ_scaled = libq::UQ<23, 13, 3, flagged>;
+
+    for (std::intmax_t const y : {1, -1, 3, -7, 255, 256, -32768, 32767}) {
+        check_divider<Q>(y, 1);
+        check_divider<Q_saturated>(y, 1);
+    }
+    check_divider<Q_saturated>(0, 1);
+
+    for (std::intmax_t const y : {1, 3, 255, 256, 65535}) {
+        check_divider<UQ>(y, 1);
+    }
+
+    for (std::intmax_t const y : {std::intmax_t(1), std::intmax_t(-1),
+                                  std::intmax_t(3), std::intmax_t(1) << 20,
+                                  std::intmax_t(-1) << 30,
+                                  (std::intmax_t(1) << 30) - 1}) {
+        check_divider<Q_wide>(y, 4097);
+    }
+    for (std::intmax_t const y : {std::intmax_t(1), std::intmax_t(7),
+                                  (std::intmax_t(1) << 23) - 1}) {
+        check_divider<UQ_scaled>(y, 257);
+    }
+}
+
+
+namespace {
+
+/// gets the number of angles which sin or cos of libq::sincos differs from
+/// the one of std::sin or std::cos
+template<typename Q>
+std::size_t inexact_sincos(double const _from, double const _to) {
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != 257u; ++i) {
+        Q const angle(_from + (_to - _from) * i / 256.0);
+        auto const result = libq::sincos(angle);
+
+        mismatches += result.first.value() != std::sin(angle).value() ||
+                      result.second.value() != std::cos(angle).value();
+    }
+
+    return mismatches;
+}
+
+}  // namespace
+
+
+/// test 'sincos':
+///     checks if sin and cos computed by one rotation are the ones of std::sin
+///     and std::cos
+BOOST_AUTO_TEST_CASE(sincos)
+{
+    std::size_t mismatches = 0u;
+    mismatches += inexact_sincos<libq::Q<15, 12> >(-7.0, 7.0);
+    mismatches += inexact_sincos<libq::Q<20, 16> >(-7.0, 7.0);
+    mismatches += inexact_sincos<libq::Q<31, 21> >(-100.0, 100.0);
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "sincos differs from sin and cos");
+
+    using Q = libq::Q<15, 12>;
+    Q sin, cos;
+    libq::sincos(Q(0.5), sin, cos);
+    BOOST_CHECK_CLOSE(static_cast<double>(sin), std::sin(0.5), 0.1);
+    BOOST_CHECK_CLOSE(static_cast<double>(cos), std::cos(0.5), 0.1);
+}
+
+
+/// test 'tan':
+///     checks if tan of one rotation is the quotient of std::sin and std::cos
+BOOST_AUTO_TEST_CASE(tan)
+{
+    using Q = libq::Q<20, 16>;
+    using tan_type = libq::details::tan_of<Q>::promoted_type;
+
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != 257u; ++i) {
+        Q const angle(-1.5 + 3.0 * i / 256.0);
+
+        mismatches += std::tan(angle).value() !=
+                      tan_type(std::sin(angle) / std::cos(angle)).value();
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "tan differs from quotient of sin and cos");
+    BOOST_CHECK_CLOSE(static_cast<double>(std::tan(Q(1.0))),
+                      std::tan(1.0),
+                      0.1);
+}
+
+
+/// test 'hyperbolic_functions':
+///     checks if sinh, cosh and tanh of one hyperbolic rotation are within
+///     few least significant bits of the exact ones, and if the results
+///     beyond the range raise the overflow events
+BOOST_AUTO_TEST_CASE(hyperbolic_functions)
+{
+    using Q = libq::Q<20, 16>;
+    using Q_thrown = libq::Q<31, 10, 0, libq::overflow_exception_policy>;
+
+    double const lsb = std::ldexp(1.0, -16);
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != 257u; ++i) {
+        Q const x(-8.0 + 16.0 * i / 256.0);
+        double const exact = static_cast<double>(x);
+        double const tolerance = 2.0 * lsb * std::cosh(exact);
+        auto const result = libq::sinhcosh(x);
+
+        mismatches +=
+            std::fabs(static_cast<double>(std::sinh(x)) - std::sinh(exact)) > tolerance ||  // NOLINT
+            std::fabs(static_cast<double>(std::cosh(x)) - std::cosh(exact)) > tolerance ||  // NOLINT
+            std::fabs(static_cast<double>(std::tanh(x)) - std::tanh(exact)) > 2.0 * lsb ||  // NOLINT
+            result.first != std::sinh(x) || result.second != std::cosh(x);
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "hyperbolic functions are inexact");
+    BOOST_CHECK_MESSAGE(std::sinh(Q(0.0)) == 0.0 && std::cosh(Q(0.0)) == 1.0 &&
+                        std::tanh(Q(0.0)) == 0.0,
+                        "hyperbolic functions of zero are inexact");
+
+    BOOST_CHECK_NO_THROW(std::cosh(Q_thrown(30.0)));
+    BOOST_CHECK_THROW(std::sinh(Q_thrown(40.0)), std::overflow_error);
+    BOOST_CHECK_THROW(std::cosh(Q_thrown(-40.0)), std::overflow_error);
+    BOOST_CHECK_MESSAGE(std::tanh(Q_thrown(-1000.0)) == -1.0,
+                        "tanh is not saturated to -1");
+}
+
+
+/// test 'polar':
+///     checks if the angle and the magnitude of one vectoring rotation are
+///     within the least significant bit of the exact ones in every quadrant
+BOOST_AUTO_TEST_CASE(polar)
+{
+    using Q = libq::Q<20, 16>;
+
+    double const lsb = std::ldexp(1.0, -16);
+    std::size_t mismatches = 0u;
+    for (std::size_t i = 0u; i != 65u; ++i) {
+        for (std::size_t j = 0u; j != 65u; ++j) {
+            Q const x(-10.0 + 20.0 * i / 64.0 + lsb);
+            Q const y(-10.0 + 20.0 * j / 64.0);
+            double const exact_x = static_cast<double>(x);
+            double const exact_y = static_cast<double>(y);
+            auto const result = libq::to_polar(x, y);
+
+            mismatches +=
+                std::fabs(static_cast<double>(std::atan2(y, x)) - std::atan2(exact_y, exact_x)) > lsb ||  // NOLINT
+                std::fabs(static_cast<double>(std::hypot(x, y)) - std::hypot(exact_x, exact_y)) > lsb ||  // NOLINT
+                result.first != std::hypot(x, y) ||
+                result.second != std::atan2(y, x);
+        }
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u, "polar coordinates are inexact");
+
+    // the vectors of few least significant bits are as exact as others in
+    // every quadrant
+    mismatches = 0u;
+    for (int i = -3; i != 4; ++i) {
+        for (int j = -3; j != 4; ++j) {
+            if (i == 0 && j == 0) {
+                continue;
+            }
+            Q const tiny_x(i * lsb), tiny_y(j * lsb);
+
+            mismatches +=
+                std::fabs(static_cast<double>(std::atan2(tiny_y, tiny_x)) - std::atan2(double(j), double(i))) > lsb ||  // NOLINT
+                std::fabs(static_cast<double>(std::hypot(tiny_x, tiny_y)) - lsb * std::hypot(double(i), double(j))) > lsb;  // NOLINT
+        }
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "polar coordinates of tiny vectors are inexact");
+
+    BOOST_CHECK_MESSAGE(std::atan2(Q(0.0), Q(0.0)) == 0.0 &&
+                        std::atan2(Q(0.0), Q(5.0)) == 0.0 &&
+                        std::hypot(Q(0.0), Q(0.0)) == 0.0 &&
+                        std::hypot(Q(-3.0), Q(0.0)) == 3.0,
+                        "polar coordinates of the axis are inexact");
+    BOOST_CHECK_CLOSE(static_cast<double>(std::atan2(Q(0.0), Q(-5.0))),
+                      3.14159265358979323846,
+                      0.001);
+}
+
+
+/// test 'exp2':
+///     checks if exp2 of the integers are exact powers of two, if exp2 is
+///     within the least significant bit of the exact one and if the
+///     arguments far below zero are reduced to zero
+BOOST_AUTO_TEST_CASE(exp2)
+{
+    using Q = libq::Q<20, 16>;
+
+    double const lsb = std::ldexp(1.0, -16);
+    std::size_t mismatches = 0u;
+    for (int k = -16; k != 16; ++k) {
+        mismatches += static_cast<double>(std::exp2(Q(k))) != std::ldexp(1.0, k);  // NOLINT
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u,
+                        "exp2 of integers are not powers of two");
+
+    mismatches = 0u;
+    for (std::size_t i = 0u; i != 513u; ++i) {
+        Q const x(-8.0 + 16.0 * i / 512.0);
+        double const exact = std::exp2(static_cast<double>(x));
+
+        mismatches += std::fabs(static_cast<double>(std::exp2(x)) - exact) >
+                      lsb * std::max(1.0, exact);
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0u, "exp2 is inexact");
+
+    using Q_wide = libq::Q<31, 21>;
+    BOOST_CHECK_MESSAGE(std::exp(Q_wide(-600.0)) == 0.0 &&
+                        std::exp2(Q_wide(-600.0)) == 0.0,
+                        "exp of large negative numbers is not zero");
+    BOOST_CHECK_CLOSE(static_cast<double>(std::exp(Q(1.0))),
+                      2.71828182845904523536,
+                      0.01);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // unit_tests